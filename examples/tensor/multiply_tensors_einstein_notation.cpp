@@ -38,6 +38,8 @@ int main()
   tensor X = fones(3,4,5);
   tensor Y = fones(4,6,3,2);
 
+  // X(_i,_j,_k)*Y(_j,_l,_i,_m) alone is a lazy expression that refers to X and Y,
+  // declare the result as tensor instead of auto to compute its value here.
   tensor Z = 2*ones(5,6,2) + X(_i,_j,_k)*Y(_j,_l,_i,_m) + 5;
 
   // Matlab Compatible Formatted Output
@@ -53,7 +55,7 @@ int main()
     matrix B1 = 2*matrix(n[1],n[2]);
     tensor v1 = 2*ones(n[0],1);
     tensor v2 = 2*ones(n[1],1);
-    //      auto v3 = tensor(shape{n[2],1},2);
+    tensor v3 = 2*ones(n[2],1);
 
     // C1(j,k) = B1(j,k) + A(i,j,k)*v1(i);
     // tensor C1 = B1 + prod(A,vector_t(n[0],1),1);
@@ -63,10 +65,9 @@ int main()
     //tensor C2 = prod(A,vector_t(n[1],1),2) + 4;
     tensor C2 = A(_,_i,_) * v2(_i,_) + 4;
 
-    // not yet implemented!
-    // C3() = A(i,j,k)*T1(i)*T2(j)*T2(k);
-        // tensor C3 = prod(prod(prod(A,v1,1),v2,1),v3,1);
-    // tensor C3 = A(_i,_j,_k) * v1(_i,_) * v2(_j,_) * v3(_k,_);
+    // C3() = A(i,j,k)*v1(i)*v2(j)*v3(k);
+    // tensor C3 = prod(prod(prod(A,v1,1),v2,1),v3,1);
+    tensor C3 = A(_i,_j,_k) * v1(_i,_) * v2(_j,_) * v3(_k,_);
 
     // formatted output
     std::cout << "% --------------------------- " << std::endl;
@@ -80,6 +81,12 @@ int main()
     std::cout << "% C2(i,k) = A(i,j,k)*v2(j) + 4;" << std::endl << std::endl;
     std::cout << "C2=" << C2 << ";" << std::endl << std::endl;
 
+    // formatted output
+    std::cout << "% --------------------------- " << std::endl;
+    std::cout << "% --------------------------- " << std::endl << std::endl;
+    std::cout << "% C3() = A(i,j,k)*v1(i)*v2(j)*v3(k);" << std::endl << std::endl;
+    std::cout << "C3=" << C3 << ";" << std::endl << std::endl;
+
   } catch (const std::exception& e) {
     std::cerr << "Cought exception " << e.what();
     std::cerr << "in the main function of multiply-tensor-einstein-notation when doing tensor-vector multiplication." << std::endl;
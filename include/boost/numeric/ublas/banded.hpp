@@ -14,7 +14,9 @@
 #define _BOOST_UBLAS_BANDED_
 
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/detail/temporary.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
 
 // Iterators based on ideas of Jeremy Siek
 
@@ -2367,6 +2369,151 @@ public:
         }
     };
 
+    // Triangular solves with the bands of a banded matrix
+    // Every unknown only touches the unknowns inside the band, so a solve takes
+    // O(n * (lower () or upper ())) operations. Right hand side columns are
+    // independent and solved in parallel.
+
+    namespace detail {
+
+        template<class M>
+        void banded_check_diagonal (const M &m) {
+            ignore_unused_variable_warning (m);
+            BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+#if BOOST_UBLAS_CHECK_ENABLE || defined (BOOST_UBLAS_SINGULAR_CHECK)
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            for (size_type n = 0; n < m.size1 (); ++ n) {
+#ifndef BOOST_UBLAS_SINGULAR_CHECK
+                BOOST_UBLAS_CHECK (m (n, n) != value_type/*zero*/(), singular ());
+#else
+                if (m (n, n) == value_type/*zero*/())
+                    singular ().raise ();
+#endif
+            }
+#endif
+        }
+
+        // m x = v with the lower bands, column oriented
+        template<class M, class V>
+        void banded_solve (const M &m, V &v, bool unit, lower_tag) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size = m.size1 ();
+            for (size_type n = 0; n < size; ++ n) {
+                if (! unit)
+                    v (n) /= m (n, n);
+                const value_type t = v (n);
+                if (t != value_type/*zero*/()) {
+                    const size_type last = (std::min) (size, size_type (n + 1 + m.lower ()));
+                    for (size_type i = n + 1; i < last; ++ i)
+                        v (i) -= m (i, n) * t;
+                }
+            }
+        }
+        // m x = v with the upper bands, column oriented
+        template<class M, class V>
+        void banded_solve (const M &m, V &v, bool unit, upper_tag) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size = m.size1 ();
+            for (size_type n = size; n > 0; -- n) {
+                const size_type k = n - 1;
+                if (! unit)
+                    v (k) /= m (k, k);
+                const value_type t = v (k);
+                if (t != value_type/*zero*/()) {
+                    const size_type first = k - (std::min) (k, m.upper ());
+                    for (size_type i = first; i < k; ++ i)
+                        v (i) -= m (i, k) * t;
+                }
+            }
+        }
+        // trans (m) x = v with the lower bands of m, i.e. dot products with its columns
+        template<class M, class V>
+        void banded_solve_trans (const M &m, V &v, lower_tag) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size = m.size1 ();
+            for (size_type n = size; n > 0; -- n) {
+                const size_type k = n - 1;
+                const size_type last = (std::min) (size, size_type (n + m.lower ()));
+                value_type t = v (k);
+                for (size_type i = n; i < last; ++ i)
+                    t -= m (i, k) * v (i);
+                v (k) = t / m (k, k);
+            }
+        }
+
+        template<class M, class E, class C>
+        void banded_inplace_solve (const M &m, vector_expression<E> &e, bool unit, C) {
+            BOOST_UBLAS_CHECK (m.size2 () == e ().size (), bad_size ());
+            if (! unit)
+                banded_check_diagonal (m);
+            banded_solve (m, e (), unit, C ());
+        }
+        template<class M, class E, class C>
+        void banded_inplace_solve (const M &m, matrix_expression<E> &e, bool unit, C) {
+            typedef typename E::size_type size_type;
+
+            BOOST_UBLAS_CHECK (m.size2 () == e ().size1 (), bad_size ());
+            if (! unit)
+                banded_check_diagonal (m);
+            const size_type size2 = e ().size2 ();
+#pragma omp parallel for if (size2 > 1 && double (e ().size1 ()) * (m.lower () + m.upper () + 1) * size2 > double (kernel_parallel_work))
+            for (size_type c = 0; c < size2; ++ c) {
+                matrix_column<E> v (e (), c);
+                banded_solve (m, v, unit, C ());
+            }
+        }
+
+    }
+
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, vector_expression<E> &e, lower_tag) {
+        detail::banded_inplace_solve (m, e, false, lower_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, vector_expression<E> &e, unit_lower_tag) {
+        detail::banded_inplace_solve (m, e, true, lower_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, vector_expression<E> &e, upper_tag) {
+        detail::banded_inplace_solve (m, e, false, upper_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, vector_expression<E> &e, unit_upper_tag) {
+        detail::banded_inplace_solve (m, e, true, upper_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, matrix_expression<E> &e, lower_tag) {
+        detail::banded_inplace_solve (m, e, false, lower_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, matrix_expression<E> &e, unit_lower_tag) {
+        detail::banded_inplace_solve (m, e, true, lower_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, matrix_expression<E> &e, upper_tag) {
+        detail::banded_inplace_solve (m, e, false, upper_tag ());
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const banded_matrix<T, L, A> &m, matrix_expression<E> &e, unit_upper_tag) {
+        detail::banded_inplace_solve (m, e, true, upper_tag ());
+    }
+
 }}}
 
 #endif
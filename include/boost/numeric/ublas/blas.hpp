@@ -11,6 +11,7 @@
 #define _BOOST_UBLAS_BLAS_
 
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/operation.hpp>
 
 namespace boost { namespace numeric { namespace ublas {
     
@@ -445,6 +446,69 @@ namespace boost { namespace numeric { namespace ublas {
             return m1 = t1 * m1 + t2 * prod (m2, herm (m2));
         }
 
+        /** \brief symmetric rank \a k update into packed storage: \f$m_1=t.m_1+t_2.(m_2.m_2^T)\f$
+     *
+     * Only the stored triangle of \c m1 is computed, every element once.
+     *
+     * \param m1 packed symmetric matrix
+     * \param t1 first scalar
+     * \param t2 second scalar
+     * \param m2 second matrix
+     * \return matrix \c m1
+         */
+        template<class T, class TRI, class L, class A, class T1, class T2, class M2>
+        symmetric_matrix<T, TRI, L, A> & srk (symmetric_matrix<T, TRI, L, A> &m1, const T1 &t1, const T2 &t2, const M2 &m2)
+    {
+            BOOST_UBLAS_CHECK (m1.size1 () == m2.size1 (), bad_size ());
+            detail::packed_rank_k<scalar_identity<T>, TRI, L> (m1.data (), m1.size1 (), t1, t2, m2);
+            return m1;
+        }
+
+        /** \brief symmetric rank \a k update into rectangular full packed storage: \f$m_1=t.m_1+t_2.(m_2.m_2^T)\f$
+     *
+     * The parts of the packed rectangle are updated by the dense blocked kernels.
+     *
+     * \param m1 symmetric matrix in rectangular full packed storage
+     * \param t1 first scalar
+     * \param t2 second scalar
+     * \param m2 second matrix
+     * \return matrix \c m1
+         */
+        template<class T, class TRI, class Z, class D, class A, class T1, class T2, class M2>
+        symmetric_matrix<T, TRI, basic_rfp_column_major<Z, D>, A> & srk (symmetric_matrix<T, TRI, basic_rfp_column_major<Z, D>, A> &m1, const T1 &t1, const T2 &t2, const M2 &m2)
+    {
+            BOOST_UBLAS_CHECK (m1.size1 () == m2.size1 (), bad_size ());
+            if (m1.size1 () != 0)
+                detail::rfp_rank_k (detail::rfp_blocks<T> (&m1.data () [0], m1.size1 (), detail::rfp_lower_columns<TRI, basic_rfp_column_major<Z, D> > ()), t1, t2, m2);
+            return m1;
+        }
+        template<class T, class TRI, class Z, class D, class A, class T1, class T2, class M2>
+        symmetric_matrix<T, TRI, basic_rfp_row_major<Z, D>, A> & srk (symmetric_matrix<T, TRI, basic_rfp_row_major<Z, D>, A> &m1, const T1 &t1, const T2 &t2, const M2 &m2)
+    {
+            BOOST_UBLAS_CHECK (m1.size1 () == m2.size1 (), bad_size ());
+            if (m1.size1 () != 0)
+                detail::rfp_rank_k (detail::rfp_blocks<T> (&m1.data () [0], m1.size1 (), detail::rfp_lower_columns<TRI, basic_rfp_row_major<Z, D> > ()), t1, t2, m2);
+            return m1;
+        }
+
+        /** \brief hermitian rank \a k update into packed storage: \f$m_1=t.m_1+t_2.(m_2.m2^H)\f$
+     *
+     * Only the stored triangle of \c m1 is computed, every element once.
+     *
+     * \param m1 packed hermitian matrix
+     * \param t1 first scalar
+     * \param t2 second scalar
+     * \param m2 second matrix
+     * \return matrix \c m1
+         */
+        template<class T, class TRI, class L, class A, class T1, class T2, class M2>
+        hermitian_matrix<T, TRI, L, A> & hrk (hermitian_matrix<T, TRI, L, A> &m1, const T1 &t1, const T2 &t2, const M2 &m2)
+    {
+            BOOST_UBLAS_CHECK (m1.size1 () == m2.size1 (), bad_size ());
+            detail::packed_rank_k<scalar_conj<T>, TRI, L> (m1.data (), m1.size1 (), t1, t2, m2);
+            return m1;
+        }
+
         /** \brief generalized symmetric rank \a k update: \f$m_1=t_1.m_1+t_2.(m_2.m3^T)+t_2.(m_3.m2^T)\f$
      *
      * \param m1 first matrix
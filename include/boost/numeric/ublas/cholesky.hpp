@@ -0,0 +1,332 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_CHOLESKY_
+#define _BOOST_UBLAS_CHOLESKY_
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+
+#include <cmath>
+
+// Cholesky factorizations of real symmetric positive definite matrices.
+// Only the lower triangle of the argument is read and overwritten with the
+// factor L, such that A = L * trans (L). This makes the functions usable on a
+// dense matrix as well as on a packed symmetric_matrix, where the factor is
+// then seen mirrored in the upper triangle.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // Unblocked left looking factorization of the diagonal block [k0, k1) of m.
+        // Returns 0 on success, else one plus the (global) index of the failing pivot.
+        template<class M>
+        typename M::size_type cholesky_factorize_block (M &m, typename M::size_type k0, typename M::size_type k1) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+            using std::sqrt;
+
+            for (size_type j = k0; j < k1; ++ j) {
+                value_type d = m (j, j);
+                for (size_type k = k0; k < j; ++ k)
+                    d -= m (j, k) * m (j, k);
+                if (! (d > value_type/*zero*/()))
+                    return j + 1;
+                const value_type ljj = sqrt (d);
+                m (j, j) = ljj;
+                for (size_type i = j + 1; i < k1; ++ i) {
+                    value_type t = m (i, j);
+                    for (size_type k = k0; k < j; ++ k)
+                        t -= m (i, k) * m (j, k);
+                    m (i, j) = t / ljj;
+                }
+            }
+            return 0;
+        }
+
+        // Position of tile (i, j), j <= i, in a row wise packed lower triangle of tiles
+        template<class S>
+        BOOST_UBLAS_INLINE
+        S lower_tile (S i, S j) {
+            return i * (i + 1) / 2 + j;
+        }
+
+        // Rows [i0, i1) of the block column [k0, k1): m (i, k0:k1) *= inverse (trans (L_kk))
+        template<class M>
+        void cholesky_solve_block (M &m, typename M::size_type i0, typename M::size_type i1,
+                                   typename M::size_type k0, typename M::size_type k1) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            for (size_type i = i0; i < i1; ++ i) {
+                for (size_type j = k0; j < k1; ++ j) {
+                    value_type t = m (i, j);
+                    for (size_type k = k0; k < j; ++ k)
+                        t -= m (i, k) * m (j, k);
+                    m (i, j) = t / m (j, j);
+                }
+            }
+        }
+
+    }
+
+    /** \brief Cholesky factorization A = L * trans (L) of a symmetric positive definite matrix.
+     *
+     * The lower triangle of \c m is overwritten with L, the strict upper
+     * triangle of a dense matrix is left untouched. Rows are computed in
+     * parallel for each column.
+     *
+     * \return 0 if \c m is positive definite, else one plus the index of the
+     * first non positive pivot. In that case only the columns before the
+     * failing pivot hold the factor.
+     */
+    template<class M>
+    typename M::size_type cholesky_factorize (M &m) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+        using std::sqrt;
+
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        const size_type size = m.size1 ();
+        for (size_type j = 0; j < size; ++ j) {
+            value_type d = m (j, j);
+            for (size_type k = 0; k < j; ++ k)
+                d -= m (j, k) * m (j, k);
+            if (! (d > value_type/*zero*/()))
+                return j + 1;
+            const value_type ljj = sqrt (d);
+            m (j, j) = ljj;
+#pragma omp parallel for if ((size - j) * j > detail::kernel_parallel_work)
+            for (size_type i = j + 1; i < size; ++ i) {
+                value_type t = m (i, j);
+                for (size_type k = 0; k < j; ++ k)
+                    t -= m (i, k) * m (j, k);
+                m (i, j) = t / ljj;
+            }
+        }
+        return 0;
+    }
+
+    /** \brief Cholesky factorization of a symmetric positive definite banded matrix.
+     *
+     * Same as cholesky_factorize (m) for a dense matrix, but only the diagonal
+     * and the lower () bands are read and overwritten with L, which has the
+     * bandwidth of \c m. Takes O(n * lower () * lower ()) operations; the
+     * update of each step runs in parallel for wide bands.
+     *
+     * \return 0 if \c m is positive definite, else one plus the index of the
+     * first non positive pivot.
+     */
+    template<class T, class L, class A>
+    typename banded_matrix<T, L, A>::size_type cholesky_factorize (banded_matrix<T, L, A> &m) {
+        typedef typename banded_matrix<T, L, A>::size_type size_type;
+        typedef T value_type;
+        using std::sqrt;
+
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        const size_type size = m.size1 ();
+        for (size_type j = 0; j < size; ++ j) {
+            const value_type d = m (j, j);
+            if (! (d > value_type/*zero*/()))
+                return j + 1;
+            const value_type ljj = sqrt (d);
+            m (j, j) = ljj;
+            const size_type last = (std::min) (size, size_type (j + 1 + m.lower ()));
+            for (size_type i = j + 1; i < last; ++ i)
+                m (i, j) /= ljj;
+#pragma omp parallel for if ((last - j) * (last - j) > 2 * detail::kernel_parallel_work)
+            for (size_type c = j + 1; c < last; ++ c) {
+                const value_type lc = m (c, j);
+                for (size_type i = c; i < last; ++ i)
+                    m (i, c) -= m (i, j) * lc;
+            }
+        }
+        return 0;
+    }
+
+    /** \brief Tiled Cholesky factorization for large matrices.
+     *
+     * Computes the same factor as cholesky_factorize (m). The lower triangle
+     * is split into square tiles of \c block_size. Every step factorizes a
+     * diagonal tile, solves the tiles below it and updates the trailing tiles,
+     * the diagonal ones by a symmetric rank-k update (SYRK) and the others by
+     * a matrix product (GEMM). The tile operations are scheduled as OpenMP
+     * tasks with data dependencies, so that the next diagonal tile can be
+     * factorized while the remaining updates of the current step still run.
+     * Without OpenMP the tasks run in program order.
+     *
+     * \return 0 if \c m is positive definite, else one plus the index of the
+     * first non positive pivot. In that case only the columns before the
+     * tile holding the failing pivot hold the factor.
+     */
+    template<class M>
+    typename M::size_type block_cholesky_factorize (M &m, typename M::size_type block_size = 128) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+        const size_type size = m.size1 ();
+        const size_type tiles = (size + block_size - 1) / block_size;
+        // One entry per tile of the lower triangle, used as dependency token of the
+        // tile tasks; the diagonal entries also receive the result of the tile factorization
+        unbounded_array<size_type> status (detail::lower_tile (tiles, size_type (0)), size_type (0));
+        size_type *status_data = tiles ? &status [0] : 0;
+
+#pragma omp parallel if (tiles > 1)
+#pragma omp single
+        for (size_type k = 0; k < tiles; ++ k) {
+            const size_type k0 = k * block_size, k1 = (std::min) (size, k0 + block_size);
+            const size_type kk = detail::lower_tile (k, k);
+
+            // Diagonal tile, skipped once an earlier tile failed
+#pragma omp task firstprivate (k, kk, k0, k1) depend (inout: status_data [kk])
+            {
+                bool failed = false;
+                for (size_type l = 0; l < k; ++ l)
+                    failed = failed || status_data [detail::lower_tile (l, l)] != 0;
+                status_data [kk] = failed ? size : detail::cholesky_factorize_block (m, k0, k1);
+            }
+
+            // Tiles below the diagonal
+            for (size_type i = k + 1; i < tiles; ++ i) {
+                const size_type i0 = i * block_size, i1 = (std::min) (size, i0 + block_size);
+#pragma omp task firstprivate (kk, k0, k1, i0, i1) depend (in: status_data [kk]) depend (inout: status_data [detail::lower_tile (i, k)])
+                {
+                    if (status_data [kk] == 0)
+                        detail::cholesky_solve_block (m, i0, i1, k0, k1);
+                }
+            }
+
+            // Trailing update
+            for (size_type i = k + 1; i < tiles; ++ i) {
+                const size_type i0 = i * block_size, i1 = (std::min) (size, i0 + block_size);
+#pragma omp task firstprivate (k0, k1, i0, i1) depend (in: status_data [detail::lower_tile (i, k)]) depend (inout: status_data [detail::lower_tile (i, i)])
+                {
+                    typename detail::sub_block<M>::type mii (detail::sub_block<M>::apply (m, i0, i1, i0, i1));
+                    detail::block_syrk (mii, value_type (-1), detail::sub_block<M>::apply (m, i0, i1, k0, k1));
+                }
+                for (size_type j = k + 1; j < i; ++ j) {
+                    const size_type j0 = j * block_size, j1 = (std::min) (size, j0 + block_size);
+#pragma omp task firstprivate (k0, k1, i0, i1, j0, j1) depend (in: status_data [detail::lower_tile (i, k)], status_data [detail::lower_tile (j, k)]) depend (inout: status_data [detail::lower_tile (i, j)])
+                    {
+                        typename detail::sub_block<M>::type mij (detail::sub_block<M>::apply (m, i0, i1, j0, j1));
+                        detail::block_gemm_nt (mij, value_type (-1),
+                                               detail::sub_block<M>::apply (m, i0, i1, k0, k1),
+                                               detail::sub_block<M>::apply (m, j0, j1, k0, k1));
+                    }
+                }
+            }
+        }
+
+        // The first failing tile holds the index of the failing pivot
+        for (size_type k = 0; k < tiles; ++ k)
+            if (status [detail::lower_tile (k, k)] != 0)
+                return status [detail::lower_tile (k, k)];
+        return 0;
+    }
+
+    namespace detail {
+
+        // Cholesky factorization of a triangle in rectangular full packed storage:
+        // L11 and L22 are factorized by the tiled algorithm, L21 is solved and
+        // the update of L22 applied by the dense blocked kernels
+        template<class T>
+        std::size_t rfp_cholesky_factorize (const rfp_blocks<T> &r, std::size_t block_size) {
+            typedef std::size_t size_type;
+            typedef typename rfp_blocks<T>::block_type block_type;
+            typedef typename block_type::value_type value_type;
+
+            block_type l11 (r.l11), l22 (r.l22);
+            size_type info = block_cholesky_factorize (l11, block_size);
+            if (info != 0)
+                return info;
+            // L21 = A21 * inverse (trans (L11)), i.e. L11 * trans (L21) = trans (A21)
+            block_type l21t (r.l21.transpose ());
+            block_solve (r.l11, l21t, lower_tag ());
+            block_syrk (l22, value_type (-1), r.l21);
+            info = block_cholesky_factorize (l22, block_size);
+            return info != 0 ? r.split + info : 0;
+        }
+
+        template<class T, class TRI, class L, class A>
+        typename symmetric_matrix<T, TRI, L, A>::size_type
+        rfp_cholesky_factorize (symmetric_matrix<T, TRI, L, A> &m, typename symmetric_matrix<T, TRI, L, A>::size_type block_size) {
+            BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+            if (m.size1 () == 0)
+                return 0;
+            return rfp_cholesky_factorize (rfp_blocks<T> (&m.data () [0], m.size1 (), rfp_lower_columns<TRI, L> ()), block_size);
+        }
+
+    }
+
+    /** \brief Tiled Cholesky factorization of a symmetric matrix in rectangular full packed storage.
+     *
+     * The packed rectangle holds the factor L as [L11 0; L21 L22] with dense
+     * blocks L11, L21 and L22, so the factorization runs on the dense kernels:
+     * L11 and L22 by the tiled algorithm of the dense case, L21 by a blocked
+     * triangular solve and the update of L22 by a symmetric rank-k update.
+     *
+     * \return 0 if \c m is positive definite, else one plus the index of the
+     * first non positive pivot.
+     */
+    template<class T, class TRI, class Z, class D, class A>
+    typename symmetric_matrix<T, TRI, basic_rfp_column_major<Z, D>, A>::size_type
+    block_cholesky_factorize (symmetric_matrix<T, TRI, basic_rfp_column_major<Z, D>, A> &m,
+                              typename symmetric_matrix<T, TRI, basic_rfp_column_major<Z, D>, A>::size_type block_size = 128) {
+        return detail::rfp_cholesky_factorize (m, block_size);
+    }
+    template<class T, class TRI, class Z, class D, class A>
+    typename symmetric_matrix<T, TRI, basic_rfp_row_major<Z, D>, A>::size_type
+    block_cholesky_factorize (symmetric_matrix<T, TRI, basic_rfp_row_major<Z, D>, A> &m,
+                              typename symmetric_matrix<T, TRI, basic_rfp_row_major<Z, D>, A>::size_type block_size = 128) {
+        return detail::rfp_cholesky_factorize (m, block_size);
+    }
+
+    // Cholesky substitution
+    template<class M, class E>
+    void cholesky_substitute (const M &m, vector_expression<E> &e) {
+        inplace_solve (m, e, lower_tag ());
+        inplace_solve (trans (m), e, upper_tag ());
+    }
+    template<class M, class E>
+    void cholesky_substitute (const M &m, matrix_expression<E> &e) {
+        inplace_solve (m, e, lower_tag ());
+        inplace_solve (trans (m), e, upper_tag ());
+    }
+
+    // Banded Cholesky substitution, both solves use the lower bands
+    template<class T, class L, class A, class E>
+    void cholesky_substitute (const banded_matrix<T, L, A> &m, vector_expression<E> &e) {
+        inplace_solve (m, e, lower_tag ());
+        detail::banded_solve_trans (m, e (), lower_tag ());
+    }
+    template<class T, class L, class A, class E>
+    void cholesky_substitute (const banded_matrix<T, L, A> &m, matrix_expression<E> &e) {
+        typedef typename E::size_type size_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size1 (), bad_size ());
+        const size_type size2 = e ().size2 ();
+#pragma omp parallel for if (size2 > 1 && double (e ().size1 ()) * m.lower () * size2 > double (detail::kernel_parallel_work))
+        for (size_type c = 0; c < size2; ++ c) {
+            matrix_column<E> v (e (), c);
+            detail::banded_solve (m, v, false, lower_tag ());
+            detail::banded_solve_trans (m, v, lower_tag ());
+        }
+    }
+
+}}}
+
+#endif
@@ -0,0 +1,301 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_BLOCK_KERNELS_
+#define _BOOST_UBLAS_BLOCK_KERNELS_
+
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+
+#include <algorithm>
+
+// Cache blocked kernels on dense matrices and ranges of dense matrices,
+// used as building blocks of the blocked factorizations. The operands are
+// accessed element wise through operator (), so any dense matrix type or
+// proxy (matrix_range, trans of a range, ...) can be passed.
+
+namespace boost { namespace numeric { namespace ublas { namespace detail {
+
+    // Cache block sizes of the kernels, in elements
+    static const std::size_t kernel_block_m = 64;
+    static const std::size_t kernel_block_n = 512;
+    static const std::size_t kernel_block_k = 128;
+    // Number of multiply adds below which a kernel runs serially
+    static const std::size_t kernel_parallel_work = 64 * 64 * 64;
+
+    // Dense rectangle inside a larger array, element (i, j) at data [i * stride1 + j * stride2].
+    // Used to run the kernels on the parts of packed storage formats.
+    template<class T>
+    class strided_block {
+    public:
+        typedef std::size_t size_type;
+        typedef typename boost::remove_const<T>::type value_type;
+        typedef T &reference;
+        typedef unknown_orientation_tag orientation_category;
+
+        BOOST_UBLAS_INLINE
+        strided_block (T *data, size_type size1, size_type size2, size_type stride1, size_type stride2):
+            data_ (data), size1_ (size1), size2_ (size2), stride1_ (stride1), stride2_ (stride2) {}
+
+        BOOST_UBLAS_INLINE
+        size_type size1 () const {
+            return size1_;
+        }
+        BOOST_UBLAS_INLINE
+        size_type size2 () const {
+            return size2_;
+        }
+        BOOST_UBLAS_INLINE
+        reference operator () (size_type i, size_type j) const {
+            BOOST_UBLAS_CHECK (i < size1_, bad_index ());
+            BOOST_UBLAS_CHECK (j < size2_, bad_index ());
+            return data_ [i * stride1_ + j * stride2_];
+        }
+
+        BOOST_UBLAS_INLINE
+        strided_block project (size_type i0, size_type i1, size_type j0, size_type j1) const {
+            BOOST_UBLAS_CHECK (i0 <= i1 && i1 <= size1_, bad_index ());
+            BOOST_UBLAS_CHECK (j0 <= j1 && j1 <= size2_, bad_index ());
+            return strided_block (data_ + i0 * stride1_ + j0 * stride2_, i1 - i0, j1 - j0, stride1_, stride2_);
+        }
+        BOOST_UBLAS_INLINE
+        strided_block transpose () const {
+            return strided_block (data_, size2_, size1_, stride2_, stride1_);
+        }
+
+    private:
+        T *data_;
+        size_type size1_, size2_;
+        size_type stride1_, stride2_;
+    };
+
+    // Submatrix [i0, i1) x [j0, j1) of a kernel operand
+    template<class M>
+    struct sub_block {
+        typedef matrix_range<M> type;
+
+        static
+        BOOST_UBLAS_INLINE
+        type apply (M &m, std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+            return type (m, range (i0, i1), range (j0, j1));
+        }
+    };
+    template<class T>
+    struct sub_block<strided_block<T> > {
+        typedef strided_block<T> type;
+
+        static
+        BOOST_UBLAS_INLINE
+        type apply (const type &m, std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+            return m.project (i0, i1, j0, j1);
+        }
+    };
+    template<class T>
+    struct sub_block<const strided_block<T> >:
+        public sub_block<strided_block<T> > {};
+
+    // Lower triangle L = [L11 0; L21 L22] of a triangle of order n in rectangular
+    // full packed storage, see basic_rfp_column_major. L11 has order split.
+    // An upper triangle U is handled through L = trans (U), which occupies the
+    // same positions.
+    template<class T>
+    struct rfp_blocks {
+        typedef std::size_t size_type;
+        typedef strided_block<T> block_type;
+
+        // lower_columns: the lower triangle is held by the columns of a column
+        // major rectangle, else the upper one is
+        BOOST_UBLAS_INLINE
+        rfp_blocks (T *data, size_type size, bool lower_columns):
+            split (lower_columns ? (size + 1) / 2 : size / 2),
+            l11 (data + (lower_columns ? 1 - size % 2 : split + 1),
+                 split, split, 1, size + 1 - size % 2),
+            l21 (data + (lower_columns ? split + 1 - size % 2 : 0),
+                 size - split, split, lower_columns ? 1 : size + 1 - size % 2, lower_columns ? size + 1 - size % 2 : 1),
+            l22 (data + (lower_columns ? (size % 2) * (size + 1 - size % 2) : split),
+                 size - split, size - split, size + 1 - size % 2, 1) {}
+
+        size_type split;
+        block_type l11, l21, l22;
+    };
+
+    // Whether the stored triangle TRI of a layout L puts the lower triangle in columns
+    template<class TRI, class L>
+    BOOST_UBLAS_INLINE
+    bool rfp_lower_columns () {
+        return TRI::other (1, 0) == boost::is_same<typename L::orientation_category, column_major_tag>::value;
+    }
+
+    // c += alpha * a * b, loop order for a row major c
+    template<class MC, class T, class MA, class MB>
+    void block_gemm (MC &c, const T &alpha, const MA &a, const MB &b, row_major_tag) {
+        typedef typename MC::size_type size_type;
+        typedef typename MC::value_type value_type;
+
+        const size_type size1 = c.size1 (), size2 = c.size2 (), size = a.size2 ();
+        const size_type blocks = (size1 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if (double (size1) * size2 * size > double (kernel_parallel_work))
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type i0 = block * kernel_block_m, i1 = (std::min) (size1, size_type (i0 + kernel_block_m));
+            for (size_type j0 = 0; j0 < size2; j0 += kernel_block_n) {
+                const size_type j1 = (std::min) (size2, size_type (j0 + kernel_block_n));
+                for (size_type p0 = 0; p0 < size; p0 += kernel_block_k) {
+                    const size_type p1 = (std::min) (size, size_type (p0 + kernel_block_k));
+                    for (size_type i = i0; i < i1; ++ i) {
+                        for (size_type p = p0; p < p1; ++ p) {
+                            const value_type t = alpha * a (i, p);
+                            if (t == value_type/*zero*/())
+                                continue;
+                            for (size_type j = j0; j < j1; ++ j)
+                                c (i, j) += t * b (p, j);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // c += alpha * a * b, loop order for a column major c
+    template<class MC, class T, class MA, class MB>
+    void block_gemm (MC &c, const T &alpha, const MA &a, const MB &b, column_major_tag) {
+        typedef typename MC::size_type size_type;
+        typedef typename MC::value_type value_type;
+
+        const size_type size1 = c.size1 (), size2 = c.size2 (), size = a.size2 ();
+        const size_type blocks = (size2 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if (double (size1) * size2 * size > double (kernel_parallel_work))
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type j0 = block * kernel_block_m, j1 = (std::min) (size2, size_type (j0 + kernel_block_m));
+            for (size_type i0 = 0; i0 < size1; i0 += kernel_block_n) {
+                const size_type i1 = (std::min) (size1, size_type (i0 + kernel_block_n));
+                for (size_type p0 = 0; p0 < size; p0 += kernel_block_k) {
+                    const size_type p1 = (std::min) (size, size_type (p0 + kernel_block_k));
+                    for (size_type j = j0; j < j1; ++ j) {
+                        for (size_type p = p0; p < p1; ++ p) {
+                            const value_type t = alpha * b (p, j);
+                            if (t == value_type/*zero*/())
+                                continue;
+                            for (size_type i = i0; i < i1; ++ i)
+                                c (i, j) += a (i, p) * t;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // c += alpha * a * b, c of unknown orientation
+    template<class MC, class T, class MA, class MB>
+    BOOST_UBLAS_INLINE
+    void block_gemm (MC &c, const T &alpha, const MA &a, const MB &b, unknown_orientation_tag) {
+        block_gemm (c, alpha, a, b, row_major_tag ());
+    }
+
+    // Dispatcher
+    template<class MC, class T, class MA, class MB>
+    void block_gemm (MC &c, const T &alpha, const MA &a, const MB &b) {
+        BOOST_UBLAS_CHECK (a.size1 () == c.size1 () && b.size2 () == c.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (a.size2 () == b.size1 (), bad_size ());
+        block_gemm (c, alpha, a, b, typename MC::orientation_category ());
+    }
+
+    // c += alpha * a * trans (b), computed as dot products of the rows of a and b
+    template<class MC, class T, class MA, class MB>
+    void block_gemm_nt (MC &c, const T &alpha, const MA &a, const MB &b) {
+        typedef typename MC::size_type size_type;
+        typedef typename MC::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a.size1 () == c.size1 () && b.size1 () == c.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (a.size2 () == b.size2 (), bad_size ());
+        const size_type size1 = c.size1 (), size2 = c.size2 (), size = a.size2 ();
+        const size_type blocks = (size1 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if (double (size1) * size2 * size > double (kernel_parallel_work))
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type i0 = block * kernel_block_m, i1 = (std::min) (size1, size_type (i0 + kernel_block_m));
+            for (size_type p0 = 0; p0 < size; p0 += kernel_block_k) {
+                const size_type p1 = (std::min) (size, size_type (p0 + kernel_block_k));
+                for (size_type i = i0; i < i1; ++ i) {
+                    for (size_type j = 0; j < size2; ++ j) {
+                        value_type t = value_type/*zero*/();
+                        for (size_type p = p0; p < p1; ++ p)
+                            t += a (i, p) * b (j, p);
+                        c (i, j) += alpha * t;
+                    }
+                }
+            }
+        }
+    }
+
+    // c += alpha * trans (a) * b for a and b with many rows and c small, e.g. the
+    // projections onto a panel of Householder vectors. The rows are split among
+    // the threads, each one accumulating a private copy of c; the copies are
+    // added at the end.
+    template<class MC, class T, class MA, class MB>
+    void block_gemm_tn (MC &c, const T &alpha, const MA &a, const MB &b) {
+        typedef typename MC::size_type size_type;
+        typedef typename MC::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a.size2 () == c.size1 () && b.size2 () == c.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (a.size1 () == b.size1 (), bad_size ());
+        const size_type size1 = c.size1 (), size2 = c.size2 (), size = a.size1 ();
+        const size_type blocks = (size + kernel_block_k - 1) / kernel_block_k;
+#pragma omp parallel if (double (size1) * size2 * size > double (kernel_parallel_work))
+        {
+            unbounded_array<value_type> acc (size1 * size2, value_type/*zero*/());
+#pragma omp for
+            for (size_type block = 0; block < blocks; ++ block) {
+                const size_type p0 = block * kernel_block_k, p1 = (std::min) (size, size_type (p0 + kernel_block_k));
+                for (size_type p = p0; p < p1; ++ p) {
+                    for (size_type i = 0; i < size1; ++ i) {
+                        const value_type t = a (p, i);
+                        if (t == value_type/*zero*/())
+                            continue;
+                        for (size_type j = 0; j < size2; ++ j)
+                            acc [i * size2 + j] += t * b (p, j);
+                    }
+                }
+            }
+#pragma omp critical
+            for (size_type i = 0; i < size1; ++ i)
+                for (size_type j = 0; j < size2; ++ j)
+                    c (i, j) += alpha * acc [i * size2 + j];
+        }
+    }
+
+    // Lower triangle of c += alpha * a * trans (a)
+    template<class MC, class T, class MA>
+    void block_syrk (MC &c, const T &alpha, const MA &a) {
+        typedef typename MC::size_type size_type;
+        typedef typename MC::value_type value_type;
+
+        BOOST_UBLAS_CHECK (c.size1 () == c.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (a.size1 () == c.size1 (), bad_size ());
+        const size_type size1 = c.size1 (), size = a.size2 ();
+        const size_type blocks = (size1 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for schedule (dynamic) if (double (size1) * size1 * size > double (2 * kernel_parallel_work))
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type i0 = block * kernel_block_m, i1 = (std::min) (size1, size_type (i0 + kernel_block_m));
+            for (size_type p0 = 0; p0 < size; p0 += kernel_block_k) {
+                const size_type p1 = (std::min) (size, size_type (p0 + kernel_block_k));
+                for (size_type i = i0; i < i1; ++ i) {
+                    for (size_type j = 0; j <= i; ++ j) {
+                        value_type t = value_type/*zero*/();
+                        for (size_type p = p0; p < p1; ++ p)
+                            t += a (i, p) * a (j, p);
+                        c (i, j) += alpha * t;
+                    }
+                }
+            }
+        }
+    }
+
+}}}}
+
+#endif
@@ -12,7 +12,9 @@
 #define _BOOST_UBLAS_SPARSE_VIEW_
 
 #include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/detail/matrix_assign.hpp>
+#include <boost/numeric/ublas/operation.hpp>
 #if BOOST_UBLAS_TYPE_CHECK
 #include <boost/numeric/ublas/matrix.hpp>
 #endif
@@ -99,10 +101,29 @@ namespace boost { namespace numeric { namespace ublas {
     };
 
 
+    namespace detail {
+
+        // Arrays are referred to, lightweight views such as c_array_view are held by value
+        template<class A>
+        struct sparse_view_storage {
+            typedef const A &type;
+        };
+        template<class T>
+        struct sparse_view_storage<c_array_view<T> > {
+            typedef const c_array_view<T> type;
+        };
+
+    }
+
     /** \brief Present existing arrays as compressed array based
      *  sparse matrix.
      *  This class provides CRS / CCS storage layout.
      *
+     *  The view is a read only sparse matrix expression: it provides the
+     *  sparse iterators and storage accessors of compressed_matrix, so it
+     *  can be used with prod, axpy_prod, norms and the compressed matrix
+     *  algorithms without copying the arrays.
+     *
      *  see also http://www.netlib.org/utk/papers/templates/node90.html
      *
      *       \param L layout type, either row_major or column_major
@@ -118,7 +139,7 @@ namespace boost { namespace numeric { namespace ublas {
         public matrix_expression<compressed_matrix_view<L, IB, IA, JA, TA> > {
 
     public:
-        typedef typename vector_view_traits<TA>::value_type value_type;
+        typedef typename boost::remove_cv<typename vector_view_traits<TA>::value_type>::type value_type;
 
     private:
         typedef value_type &true_reference;
@@ -141,8 +162,8 @@ namespace boost { namespace numeric { namespace ublas {
         typedef typename vector_view_traits<JA>::difference_type difference_type;
         typedef const value_type & const_reference;
 
-        // do NOT define reference type, because class is read only
-        // typedef value_type & reference;
+        // the class is read only, references are the const references of the arrays
+        typedef const value_type & reference;
 
         typedef IA rowptr_array_type;
         typedef JA index_array_type;
@@ -150,11 +171,8 @@ namespace boost { namespace numeric { namespace ublas {
         typedef const matrix_reference<const self_type> const_closure_type;
         typedef matrix_reference<self_type> closure_type;
 
-        // FIXME: define a corresponding temporary type
-        // typedef compressed_vector<T, IB, IA, TA> vector_temporary_type;
-
-        // FIXME: define a corresponding temporary type
-        // typedef self_type matrix_temporary_type;
+        typedef compressed_vector<value_type, IB> vector_temporary_type;
+        typedef compressed_matrix<value_type, L, IB> matrix_temporary_type;
 
         typedef sparse_tag storage_category;
         typedef typename L::orientation_category orientation_category;
@@ -164,6 +182,7 @@ namespace boost { namespace numeric { namespace ublas {
         //
 
     private:
+        typedef typename vector_view_traits<rowptr_array_type>::const_iterator vector_const_subiterator_type;
         typedef typename vector_view_traits<index_array_type>::const_iterator const_subiterator_type;
 
         //
@@ -198,32 +217,61 @@ namespace boost { namespace numeric { namespace ublas {
             value_data_(o.value_data_)
         {}
 
-        //
-        // implement immutable iterator types
-        //
-
-        class const_iterator1 {};
-        class const_iterator2 {};
-
-        typedef reverse_iterator_base1<const_iterator1> const_reverse_iterator1;
-        typedef reverse_iterator_base2<const_iterator2> const_reverse_iterator2;
-
         //
         // implement all read only methods for the matrix expression concept
         // 
 
         //! return the number of rows 
+        BOOST_UBLAS_INLINE
         index_type size1() const {
             return size1_;
         }
 
         //! return the number of columns
+        BOOST_UBLAS_INLINE
         index_type size2() const {
             return size2_;
         }
 
+        //! return the number of stored elements
+        BOOST_UBLAS_INLINE
+        array_size_type nnz () const {
+            return nnz_;
+        }
+        BOOST_UBLAS_INLINE
+        array_size_type nnz_capacity () const {
+            return nnz_;
+        }
+        BOOST_UBLAS_INLINE
+        size_type filled1 () const {
+            return layout_type::size_M (size1_, size2_) + 1;
+        }
+        BOOST_UBLAS_INLINE
+        array_size_type filled2 () const {
+            return nnz_;
+        }
+
+        // Storage accessors, with the same meaning as for compressed_matrix
+        BOOST_UBLAS_INLINE
+        static size_type index_base () {
+            return IB;
+        }
+        BOOST_UBLAS_INLINE
+        const rowptr_array_type &index1_data () const {
+            return index1_data_;
+        }
+        BOOST_UBLAS_INLINE
+        const index_array_type &index2_data () const {
+            return index2_data_;
+        }
+        BOOST_UBLAS_INLINE
+        const value_array_type &value_data () const {
+            return value_data_;
+        }
+
         //! return value at position (i,j)
-        value_type operator()(index_type i, index_type j) const {
+        BOOST_UBLAS_INLINE
+        const_reference operator()(index_type i, index_type j) const {
             const_pointer p = find_element(i,j);
             if (!p) {
                 return zero_;
@@ -231,13 +279,9 @@ namespace boost { namespace numeric { namespace ublas {
                 return *p;
             }
         }
-        
-
-    private:
-        //
-        // private helper functions
-        //
 
+        // Element lookup
+        BOOST_UBLAS_INLINE
         const_pointer find_element (index_type i, index_type j) const {
             index_type element1 (layout_type::index_M (i, j));
             index_type element2 (layout_type::index_m (i, j));
@@ -245,13 +289,529 @@ namespace boost { namespace numeric { namespace ublas {
             const array_size_type itv      = zero_based( index1_data_[element1] );
             const array_size_type itv_next = zero_based( index1_data_[element1+1] );
 
-            const_subiterator_type it_start = boost::next(vector_view_traits<index_array_type>::begin(index2_data_),itv);
-            const_subiterator_type it_end = boost::next(vector_view_traits<index_array_type>::begin(index2_data_),itv_next);
+            const_subiterator_type it_start = boost::next(index2_begin (),itv);
+            const_subiterator_type it_end = boost::next(index2_begin (),itv_next);
             const_subiterator_type it = find_index_in_row(it_start, it_end, element2) ;
             
             if (it == it_end || *it != k_based (element2))
                 return 0;
-            return &value_data_ [it - vector_view_traits<index_array_type>::begin(index2_data_)];
+            return &value_data_ [it - index2_begin ()];
+        }
+
+        class const_iterator1;
+        class const_iterator2;
+        typedef const_iterator1 iterator1;
+        typedef const_iterator2 iterator2;
+        typedef reverse_iterator_base1<const_iterator1> const_reverse_iterator1;
+        typedef reverse_iterator_base2<const_iterator2> const_reverse_iterator2;
+        typedef const_reverse_iterator1 reverse_iterator1;
+        typedef const_reverse_iterator2 reverse_iterator2;
+
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.    
+        const_iterator1 find1 (int rank, size_type i, size_type j, int direction = 1) const {
+            const size_type filled1 = this->filled1 ();
+            for (;;) {
+                array_size_type address1 (layout_type::index_M (i, j));
+                array_size_type address2 (layout_type::index_m (i, j));
+                vector_const_subiterator_type itv (index1_begin () + (std::min) (array_size_type (filled1 - 1), address1));
+                if (filled1 <= address1 + 1)
+                    return const_iterator1 (*this, rank, i, j, itv, index2_begin () + nnz_);
+
+                const_subiterator_type it_begin (index2_begin () + zero_based (*itv));
+                const_subiterator_type it_end (index2_begin () + zero_based (*(itv + 1)));
+
+                const_subiterator_type it (detail::lower_bound (it_begin, it_end, k_based (address2), std::less<size_type> ()));
+                if (rank == 0)
+                    return const_iterator1 (*this, rank, i, j, itv, it);
+                if (it != it_end && zero_based (*it) == address2)
+                    return const_iterator1 (*this, rank, i, j, itv, it);
+                if (direction > 0) {
+                    if (layout_type::fast_i ()) {
+                        if (it == it_end)
+                            return const_iterator1 (*this, rank, i, j, itv, it);
+                        i = zero_based (*it);
+                    } else {
+                        if (i >= size1_)
+                            return const_iterator1 (*this, rank, i, j, itv, it);
+                        ++ i;
+                    }
+                } else /* if (direction < 0)  */ {
+                    if (layout_type::fast_i ()) {
+                        if (it == index2_begin () + zero_based (*itv))
+                            return const_iterator1 (*this, rank, i, j, itv, it);
+                        i = zero_based (*(it - 1));
+                    } else {
+                        if (i == 0)
+                            return const_iterator1 (*this, rank, i, j, itv, it);
+                        -- i;
+                    }
+                }
+            }
+        }
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.    
+        const_iterator2 find2 (int rank, size_type i, size_type j, int direction = 1) const {
+            const size_type filled1 = this->filled1 ();
+            for (;;) {
+                array_size_type address1 (layout_type::index_M (i, j));
+                array_size_type address2 (layout_type::index_m (i, j));
+                vector_const_subiterator_type itv (index1_begin () + (std::min) (array_size_type (filled1 - 1), address1));
+                if (filled1 <= address1 + 1)
+                    return const_iterator2 (*this, rank, i, j, itv, index2_begin () + nnz_);
+
+                const_subiterator_type it_begin (index2_begin () + zero_based (*itv));
+                const_subiterator_type it_end (index2_begin () + zero_based (*(itv + 1)));
+
+                const_subiterator_type it (detail::lower_bound (it_begin, it_end, k_based (address2), std::less<size_type> ()));
+                if (rank == 0)
+                    return const_iterator2 (*this, rank, i, j, itv, it);
+                if (it != it_end && zero_based (*it) == address2)
+                    return const_iterator2 (*this, rank, i, j, itv, it);
+                if (direction > 0) {
+                    if (layout_type::fast_j ()) {
+                        if (it == it_end)
+                            return const_iterator2 (*this, rank, i, j, itv, it);
+                        j = zero_based (*it);
+                    } else {
+                        if (j >= size2_)
+                            return const_iterator2 (*this, rank, i, j, itv, it);
+                        ++ j;
+                    }
+                } else /* if (direction < 0)  */ {
+                    if (layout_type::fast_j ()) {
+                        if (it == index2_begin () + zero_based (*itv))
+                            return const_iterator2 (*this, rank, i, j, itv, it);
+                        j = zero_based (*(it - 1));
+                    } else {
+                        if (j == 0)
+                            return const_iterator2 (*this, rank, i, j, itv, it);
+                        -- j;
+                    }
+                }
+            }
+        }
+
+        class const_iterator1:
+            public container_const_reference<compressed_matrix_view>,
+            public bidirectional_iterator_base<sparse_bidirectional_iterator_tag,
+                                               const_iterator1, value_type> {
+        public:
+            typedef typename compressed_matrix_view::value_type value_type;
+            typedef typename compressed_matrix_view::difference_type difference_type;
+            typedef typename compressed_matrix_view::const_reference reference;
+            typedef typename compressed_matrix_view::const_pointer pointer;
+
+            typedef const_iterator2 dual_iterator_type;
+            typedef const_reverse_iterator2 dual_reverse_iterator_type;
+
+            // Construction and destruction
+            BOOST_UBLAS_INLINE
+            const_iterator1 ():
+                container_const_reference<self_type> (), rank_ (), i_ (), j_ (), itv_ (), it_ () {}
+            BOOST_UBLAS_INLINE
+            const_iterator1 (const self_type &m, int rank, size_type i, size_type j, const vector_const_subiterator_type &itv, const const_subiterator_type &it):
+                container_const_reference<self_type> (m), rank_ (rank), i_ (i), j_ (j), itv_ (itv), it_ (it) {}
+
+            // Arithmetic
+            BOOST_UBLAS_INLINE
+            const_iterator1 &operator ++ () {
+                if (rank_ == 1 && layout_type::fast_i ())
+                    ++ it_;
+                else {
+                    i_ = index1 () + 1;
+                    if (rank_ == 1)
+                        *this = (*this) ().find1 (rank_, i_, j_, 1);
+                }
+                return *this;
+            }
+            BOOST_UBLAS_INLINE
+            const_iterator1 &operator -- () {
+                if (rank_ == 1 && layout_type::fast_i ())
+                    -- it_;
+                else {
+                    --i_;
+                    if (rank_ == 1)
+                        *this = (*this) ().find1 (rank_, i_, j_, -1);
+                }
+                return *this;
+            }
+
+            // Dereference
+            BOOST_UBLAS_INLINE
+            const_reference operator * () const {
+                BOOST_UBLAS_CHECK (index1 () < (*this) ().size1 (), bad_index ());
+                BOOST_UBLAS_CHECK (index2 () < (*this) ().size2 (), bad_index ());
+                if (rank_ == 1) {
+                    return (*this) ().value_data_ [it_ - (*this) ().index2_begin ()];
+                } else {
+                    const_pointer p = (*this) ().find_element (i_, j_);
+                    return p ? *p : zero_;
+                }
+            }
+
+#ifndef BOOST_UBLAS_NO_NESTED_CLASS_RELATION
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator2 begin () const {
+                const self_type &m = (*this) ();
+                return m.find2 (1, index1 (), 0);
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator2 cbegin () const {
+                return begin ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator2 end () const {
+                const self_type &m = (*this) ();
+                return m.find2 (1, index1 (), m.size2 ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator2 cend () const {
+                return end ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator2 rbegin () const {
+                return const_reverse_iterator2 (end ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator2 crbegin () const {
+                return rbegin ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator2 rend () const {
+                return const_reverse_iterator2 (begin ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator2 crend () const {
+                return rend ();
+            }
+#endif
+
+            // Indices
+            BOOST_UBLAS_INLINE
+            size_type index1 () const {
+                if (rank_ == 1) {
+                    BOOST_UBLAS_CHECK (layout_type::index_M (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_)) < (*this) ().size1 (), bad_index ());
+                    return layout_type::index_M (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_));
+                } else {
+                    return i_;
+                }
+            }
+            BOOST_UBLAS_INLINE
+            size_type index2 () const {
+                if (rank_ == 1) {
+                    BOOST_UBLAS_CHECK (layout_type::index_m (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_)) < (*this) ().size2 (), bad_index ());
+                    return layout_type::index_m (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_));
+                } else {
+                    return j_;
+                }
+            }
+
+            // Assignment
+            BOOST_UBLAS_INLINE
+            const_iterator1 &operator = (const const_iterator1 &it) {
+                container_const_reference<self_type>::assign (&it ());
+                rank_ = it.rank_;
+                i_ = it.i_;
+                j_ = it.j_;
+                itv_ = it.itv_;
+                it_ = it.it_;
+                return *this;
+            }
+
+            // Comparison
+            BOOST_UBLAS_INLINE
+            bool operator == (const const_iterator1 &it) const {
+                BOOST_UBLAS_CHECK (&(*this) () == &it (), external_logic ());
+                if (rank_ == 1 || it.rank_ == 1) {
+                    return it_ == it.it_;
+                } else {
+                    return i_ == it.i_ && j_ == it.j_;
+                }
+            }
+
+        private:
+            int rank_;
+            size_type i_;
+            size_type j_;
+            vector_const_subiterator_type itv_;
+            const_subiterator_type it_;
+        };
+
+        BOOST_UBLAS_INLINE
+        const_iterator1 begin1 () const {
+            return find1 (0, 0, 0);
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator1 cbegin1 () const {
+            return begin1 ();
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator1 end1 () const {
+            return find1 (0, size1_, 0);
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator1 cend1 () const {
+            return end1 ();
+        }
+
+        class const_iterator2:
+            public container_const_reference<compressed_matrix_view>,
+            public bidirectional_iterator_base<sparse_bidirectional_iterator_tag,
+                                               const_iterator2, value_type> {
+        public:
+            typedef typename compressed_matrix_view::value_type value_type;
+            typedef typename compressed_matrix_view::difference_type difference_type;
+            typedef typename compressed_matrix_view::const_reference reference;
+            typedef typename compressed_matrix_view::const_pointer pointer;
+
+            typedef const_iterator1 dual_iterator_type;
+            typedef const_reverse_iterator1 dual_reverse_iterator_type;
+
+            // Construction and destruction
+            BOOST_UBLAS_INLINE
+            const_iterator2 ():
+                container_const_reference<self_type> (), rank_ (), i_ (), j_ (), itv_ (), it_ () {}
+            BOOST_UBLAS_INLINE
+            const_iterator2 (const self_type &m, int rank, size_type i, size_type j, const vector_const_subiterator_type itv, const const_subiterator_type &it):
+                container_const_reference<self_type> (m), rank_ (rank), i_ (i), j_ (j), itv_ (itv), it_ (it) {}
+
+            // Arithmetic
+            BOOST_UBLAS_INLINE
+            const_iterator2 &operator ++ () {
+                if (rank_ == 1 && layout_type::fast_j ())
+                    ++ it_;
+                else {
+                    j_ = index2 () + 1;
+                    if (rank_ == 1)
+                        *this = (*this) ().find2 (rank_, i_, j_, 1);
+                }
+                return *this;
+            }
+            BOOST_UBLAS_INLINE
+            const_iterator2 &operator -- () {
+                if (rank_ == 1 && layout_type::fast_j ())
+                    -- it_;
+                else {
+                    --j_;
+                    if (rank_ == 1)
+                        *this = (*this) ().find2 (rank_, i_, j_, -1);
+                }
+                return *this;
+            }
+
+            // Dereference
+            BOOST_UBLAS_INLINE
+            const_reference operator * () const {
+                BOOST_UBLAS_CHECK (index1 () < (*this) ().size1 (), bad_index ());
+                BOOST_UBLAS_CHECK (index2 () < (*this) ().size2 (), bad_index ());
+                if (rank_ == 1) {
+                    return (*this) ().value_data_ [it_ - (*this) ().index2_begin ()];
+                } else {
+                    const_pointer p = (*this) ().find_element (i_, j_);
+                    return p ? *p : zero_;
+                }
+            }
+
+#ifndef BOOST_UBLAS_NO_NESTED_CLASS_RELATION
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator1 begin () const {
+                const self_type &m = (*this) ();
+                return m.find1 (1, 0, index2 ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator1 cbegin () const {
+                return begin ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator1 end () const {
+                const self_type &m = (*this) ();
+                return m.find1 (1, m.size1 (), index2 ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_iterator1 cend () const {
+                return end ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator1 rbegin () const {
+                return const_reverse_iterator1 (end ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator1 crbegin () const {
+                return rbegin ();
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator1 rend () const {
+                return const_reverse_iterator1 (begin ());
+            }
+            BOOST_UBLAS_INLINE
+#ifdef BOOST_UBLAS_MSVC_NESTED_CLASS_RELATION
+            typename self_type::
+#endif
+            const_reverse_iterator1 crend () const {
+                return rend ();
+            }
+#endif
+
+            // Indices
+            BOOST_UBLAS_INLINE
+            size_type index1 () const {
+                if (rank_ == 1) {
+                    BOOST_UBLAS_CHECK (layout_type::index_M (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_)) < (*this) ().size1 (), bad_index ());
+                    return layout_type::index_M (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_));
+                } else {
+                    return i_;
+                }
+            }
+            BOOST_UBLAS_INLINE
+            size_type index2 () const {
+                if (rank_ == 1) {
+                    BOOST_UBLAS_CHECK (layout_type::index_m (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_)) < (*this) ().size2 (), bad_index ());
+                    return layout_type::index_m (itv_ - (*this) ().index1_begin (), (*this) ().zero_based (*it_));
+                } else {
+                    return j_;
+                }
+            }
+
+            // Assignment
+            BOOST_UBLAS_INLINE
+            const_iterator2 &operator = (const const_iterator2 &it) {
+                container_const_reference<self_type>::assign (&it ());
+                rank_ = it.rank_;
+                i_ = it.i_;
+                j_ = it.j_;
+                itv_ = it.itv_;
+                it_ = it.it_;
+                return *this;
+            }
+
+            // Comparison
+            BOOST_UBLAS_INLINE
+            bool operator == (const const_iterator2 &it) const {
+                BOOST_UBLAS_CHECK (&(*this) () == &it (), external_logic ());
+                if (rank_ == 1 || it.rank_ == 1) {
+                    return it_ == it.it_;
+                } else {
+                    return i_ == it.i_ && j_ == it.j_;
+                }
+            }
+
+        private:
+            int rank_;
+            size_type i_;
+            size_type j_;
+            vector_const_subiterator_type itv_;
+            const_subiterator_type it_;
+        };
+
+        BOOST_UBLAS_INLINE
+        const_iterator2 begin2 () const {
+            return find2 (0, 0, 0);
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator2 cbegin2 () const {
+            return begin2 ();
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator2 end2 () const {
+            return find2 (0, 0, size2_);
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator2 cend2 () const {
+            return end2 ();
+        }
+
+        // Reverse iterators
+
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator1 rbegin1 () const {
+            return const_reverse_iterator1 (end1 ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator1 crbegin1 () const {
+            return rbegin1 ();
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator1 rend1 () const {
+            return const_reverse_iterator1 (begin1 ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator1 crend1 () const {
+            return rend1 ();
+        }
+
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator2 rbegin2 () const {
+            return const_reverse_iterator2 (end2 ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator2 crbegin2 () const {
+            return rbegin2 ();
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator2 rend2 () const {
+            return const_reverse_iterator2 (begin2 ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator2 crend2 () const {
+            return rend2 ();
+        }
+
+    private:
+        //
+        // private helper functions
+        //
+
+        BOOST_UBLAS_INLINE
+        vector_const_subiterator_type index1_begin () const {
+            return vector_view_traits<rowptr_array_type>::begin (index1_data_);
+        }
+        BOOST_UBLAS_INLINE
+        const_subiterator_type index2_begin () const {
+            return vector_view_traits<index_array_type>::begin (index2_data_);
         }
 
         const_subiterator_type find_index_in_row(const_subiterator_type it_start
@@ -262,8 +822,6 @@ namespace boost { namespace numeric { namespace ublas {
                                      , k_based (index) );
         }
 
-
-    private:
         void storage_invariants () const {
             BOOST_UBLAS_CHECK (index1_data_ [layout_type::size_M (size1_, size2_)] == k_based (nnz_), external_logic ());
         }
@@ -273,9 +831,9 @@ namespace boost { namespace numeric { namespace ublas {
 
         array_size_type nnz_;
 
-        const rowptr_array_type & index1_data_;
-        const index_array_type & index2_data_;
-        const value_array_type & value_data_;
+        typename detail::sparse_view_storage<rowptr_array_type>::type index1_data_;
+        typename detail::sparse_view_storage<index_array_type>::type index2_data_;
+        typename detail::sparse_view_storage<value_array_type>::type value_data_;
 
         static const value_type zero_;
 
@@ -288,8 +846,6 @@ namespace boost { namespace numeric { namespace ublas {
             return zero_based_index + IB;
         }
 
-        friend class iterator1;
-        friend class iterator2;
         friend class const_iterator1;
         friend class const_iterator2;
     };
@@ -312,6 +868,160 @@ namespace boost { namespace numeric { namespace ublas {
 
     }
 
+    // Products with a compressed_matrix_view reading the external arrays directly.
+    // Rows of a row major view (columns of a column major view in the transposed
+    // product) are gathered independently and processed in parallel.
+
+    template<class V, class L, std::size_t IB, class IA, class JA, class TA, class E2>
+    V &
+    axpy_prod (const compressed_matrix_view<L, IB, IA, JA, TA> &e1,
+               const vector_expression<E2> &e2,
+               V &v, row_major_tag) {
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::size_type size_type;
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::array_size_type array_size_type;
+        typedef typename V::value_type value_type;
+
+        const size_type size1 = e1.size1 ();
+#pragma omp parallel for
+        for (size_type i = 0; i < size1; ++ i) {
+            const array_size_type begin = e1.index1_data () [i] - IB;
+            const array_size_type end = e1.index1_data () [i + 1] - IB;
+            value_type t (v (i));
+            for (array_size_type k = begin; k < end; ++ k)
+                t += e1.value_data () [k] * e2 () (e1.index2_data () [k] - IB);
+            v (i) = t;
+        }
+        return v;
+    }
+
+    template<class V, class L, std::size_t IB, class IA, class JA, class TA, class E2>
+    V &
+    axpy_prod (const compressed_matrix_view<L, IB, IA, JA, TA> &e1,
+               const vector_expression<E2> &e2,
+               V &v, column_major_tag) {
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::size_type size_type;
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::array_size_type array_size_type;
+
+        for (size_type j = 0; j < e1.size2 (); ++ j) {
+            const array_size_type begin = e1.index1_data () [j] - IB;
+            const array_size_type end = e1.index1_data () [j + 1] - IB;
+            for (array_size_type k = begin; k < end; ++ k)
+                v (e1.index2_data () [k] - IB) += e1.value_data () [k] * e2 () (j);
+        }
+        return v;
+    }
+
+    // Dispatcher
+    template<class V, class L, std::size_t IB, class IA, class JA, class TA, class E2>
+    V &
+    axpy_prod (const compressed_matrix_view<L, IB, IA, JA, TA> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+        typedef typename L::orientation_category orientation_category;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        return axpy_prod (e1, e2, v, orientation_category ());
+    }
+
+    template<class V, class E1, class L, std::size_t IB, class IA, class JA, class TA>
+    V &
+    axpy_prod (const vector_expression<E1> &e1,
+               const compressed_matrix_view<L, IB, IA, JA, TA> &e2,
+               V &v, column_major_tag) {
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::size_type size_type;
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::array_size_type array_size_type;
+        typedef typename V::value_type value_type;
+
+        const size_type size2 = e2.size2 ();
+#pragma omp parallel for
+        for (size_type j = 0; j < size2; ++ j) {
+            const array_size_type begin = e2.index1_data () [j] - IB;
+            const array_size_type end = e2.index1_data () [j + 1] - IB;
+            value_type t (v (j));
+            for (array_size_type k = begin; k < end; ++ k)
+                t += e2.value_data () [k] * e1 () (e2.index2_data () [k] - IB);
+            v (j) = t;
+        }
+        return v;
+    }
+
+    template<class V, class E1, class L, std::size_t IB, class IA, class JA, class TA>
+    V &
+    axpy_prod (const vector_expression<E1> &e1,
+               const compressed_matrix_view<L, IB, IA, JA, TA> &e2,
+               V &v, row_major_tag) {
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::size_type size_type;
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::array_size_type array_size_type;
+
+        for (size_type i = 0; i < e2.size1 (); ++ i) {
+            const array_size_type begin = e2.index1_data () [i] - IB;
+            const array_size_type end = e2.index1_data () [i + 1] - IB;
+            for (array_size_type k = begin; k < end; ++ k)
+                v (e2.index2_data () [k] - IB) += e2.value_data () [k] * e1 () (i);
+        }
+        return v;
+    }
+
+    // Dispatcher
+    template<class V, class E1, class L, std::size_t IB, class IA, class JA, class TA>
+    V &
+    axpy_prod (const vector_expression<E1> &e1,
+               const compressed_matrix_view<L, IB, IA, JA, TA> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+        typedef typename L::orientation_category orientation_category;
+
+        BOOST_UBLAS_CHECK (e1 ().size () == e2.size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e2.size2 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e2.size2 ()));
+        return axpy_prod (e1, e2, v, orientation_category ());
+    }
+
+    // Sparse times dense matrix: every stored element updates a whole row of the result.
+    // Sparse operands or results use the generic sparse axpy_prod.
+    template<class M, class L, std::size_t IB, class IA, class JA, class TA, class E2>
+    typename boost::enable_if_c<detail::spmm_dense_operands<M, E2>::value, M &>::type
+    axpy_prod (const compressed_matrix_view<L, IB, IA, JA, TA> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, bool init = true) {
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::size_type size_type;
+        typedef typename compressed_matrix_view<L, IB, IA, JA, TA>::array_size_type array_size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == m.size1 () && e2 ().size2 () == m.size2 (), bad_size ());
+        if (init)
+            m.assign (zero_matrix<value_type> (m.size1 (), m.size2 ()));
+        const size_type size_M = L::size_M (e1.size1 (), e1.size2 ());
+        const size_type size2 = m.size2 ();
+        if (L::fast_j ()) {
+#pragma omp parallel for
+            for (size_type i = 0; i < size_M; ++ i) {
+                for (array_size_type k = e1.index1_data () [i] - IB; k < array_size_type (e1.index1_data () [i + 1] - IB); ++ k) {
+                    const value_type a = e1.value_data () [k];
+                    const size_type j = e1.index2_data () [k] - IB;
+                    for (size_type c = 0; c < size2; ++ c)
+                        m (i, c) += a * e2 () (j, c);
+                }
+            }
+        } else {
+            for (size_type j = 0; j < size_M; ++ j) {
+                for (array_size_type k = e1.index1_data () [j] - IB; k < array_size_type (e1.index1_data () [j + 1] - IB); ++ k) {
+                    const value_type a = e1.value_data () [k];
+                    const size_type i = e1.index2_data () [k] - IB;
+                    for (size_type c = 0; c < size2; ++ c)
+                        m (i, c) += a * e2 () (j, c);
+                }
+            }
+        }
+        return m;
+    }
+
 }}}
 
 #endif
@@ -1749,6 +1749,69 @@ namespace boost { namespace numeric { namespace ublas {
         }
     };
 
+    // Rectangular full packed (RFP) layouts. A triangle of order n is kept in a
+    // dense column major rectangle of n + 1 rows and n / 2 columns for even n,
+    // n rows and (n + 1) / 2 columns for odd n, i.e. in n * (n + 1) / 2 elements.
+    // The triangle is split into two triangles and a full block; one of the
+    // triangles is stored transposed next to the other, so each of the three
+    // parts is a dense submatrix of the rectangle with leading dimension
+    // n + 1 - n % 2. Triangles of the row major layout are the transposed
+    // triangles of the column major one.
+    // Only the triangular access functions differ from the dense layouts.
+    template <class Z, class D>
+    struct basic_rfp_column_major : public basic_column_major<Z, D> {
+        typedef Z size_type;
+        typedef basic_rfp_row_major<Z, D> transposed_layout;
+
+        // Triangular access
+        // Lower triangle: columns [0, n1) at rows [s, n + s) of the rectangle,
+        // columns [n1, n) transposed at the top of it, n1 = (n + 1) / 2, s = 1 - n % 2.
+        static
+        BOOST_UBLAS_INLINE
+        size_type lower_element (size_type i, size_type size_i, size_type j, size_type size_j) {
+            BOOST_UBLAS_CHECK (i < size_i, bad_index ());
+            BOOST_UBLAS_CHECK (j < size_j, bad_index ());
+            BOOST_UBLAS_CHECK (i >= j, bad_index ());
+            const size_type size = (std::max) (size_i, size_j);
+            const size_type s = 1 - size % 2, ld = size + s, n1 = (size + 1) / 2;
+            if (j < n1)
+                return j * ld + i + s;
+            return (i - n1 + 1 - s) * ld + (j - n1);
+        }
+        // Upper triangle: columns [n1, n) at rows [0, n) of the rectangle,
+        // rows [0, n1) transposed at its bottom, n1 = n / 2.
+        static
+        BOOST_UBLAS_INLINE
+        size_type upper_element (size_type i, size_type size_i, size_type j, size_type size_j) {
+            BOOST_UBLAS_CHECK (i < size_i, bad_index ());
+            BOOST_UBLAS_CHECK (j < size_j, bad_index ());
+            BOOST_UBLAS_CHECK (i <= j, bad_index ());
+            const size_type size = (std::max) (size_i, size_j);
+            const size_type ld = size + 1 - size % 2, n1 = size / 2;
+            if (j >= n1)
+                return (j - n1) * ld + i;
+            return i * ld + n1 + 1 + j;
+        }
+    };
+
+    template <class Z, class D>
+    struct basic_rfp_row_major : public basic_row_major<Z, D> {
+        typedef Z size_type;
+        typedef basic_rfp_column_major<Z, D> transposed_layout;
+
+        // Triangular access
+        static
+        BOOST_UBLAS_INLINE
+        size_type lower_element (size_type i, size_type size_i, size_type j, size_type size_j) {
+            return basic_rfp_column_major<Z, D>::upper_element (j, size_j, i, size_i);
+        }
+        static
+        BOOST_UBLAS_INLINE
+        size_type upper_element (size_type i, size_type size_i, size_type j, size_type size_j) {
+            return basic_rfp_column_major<Z, D>::lower_element (j, size_j, i, size_i);
+        }
+    };
+
 
     template <class Z>
     struct basic_full {
@@ -43,6 +43,8 @@ namespace boost { namespace numeric { namespace ublas {
     class map_std;
     template<class I, class T, class ALLOC = std::allocator<std::pair<I, T> > >
     class map_array;
+    template<class I, class T, class ALLOC = std::allocator<std::pair<I, T> > >
+    class hash_map_array;
 
     // Expression types
     struct scalar_tag {};
@@ -131,6 +133,15 @@ namespace boost { namespace numeric { namespace ublas {
     struct basic_column_major;
     typedef basic_column_major<> column_major;
 
+    // Rectangular full packed layouts of triangular and symmetric matrices
+    template <class Z = std::size_t, class D = std::ptrdiff_t>
+    struct basic_rfp_row_major;
+    typedef basic_rfp_row_major<> rfp_row_major;
+
+    template <class Z = std::size_t, class D = std::ptrdiff_t>
+    struct basic_rfp_column_major;
+    typedef basic_rfp_column_major<> rfp_column_major;
+
     template<class T, class L = row_major, class A = unbounded_array<T> >
     class matrix;
 #ifdef BOOST_UBLAS_CPP_GE_2011
@@ -198,6 +209,10 @@ namespace boost { namespace numeric { namespace ublas {
     class banded_matrix;
     template<class T, class L = row_major, class A = unbounded_array<T> >
     class diagonal_matrix;
+    template<class M>
+    class banded_adaptor;
+    template<class M>
+    class diagonal_adaptor;
 
     template<class T, class TRI = lower, class L = row_major, class A = unbounded_array<T> >
     class triangular_matrix;
@@ -0,0 +1,466 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_ILU_
+#define _BOOST_UBLAS_ILU_
+
+#include <boost/numeric/ublas/triangular_sparse.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Incomplete factorizations of row major compressed matrices in the spirit of
+// Saad, "Iterative Methods for Sparse Linear Systems", chapter 10.
+// The factors overwrite the matrix: ILU stores the unit lower factor in the
+// strict lower triangle and the upper factor in the upper triangle; IC stores
+// the Cholesky factor L in the lower triangle and mirrors L^T into the strict
+// upper triangle, so both triangular solves run row by row.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // Position of the diagonal element of every row, nnz () if absent
+        template<class M, class PA>
+        void compressed_diagonal (const M &m, PA &diagonal) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+
+            const size_type ib = M::index_base ();
+            for (size_type i = 0; i < m.size1 (); ++ i) {
+                diagonal [i] = m.nnz ();
+                if (i + 1 >= m.filled1 ())
+                    continue;
+                for (array_size_type k = m.index1_data () [i] - ib; k < array_size_type (m.index1_data () [i + 1] - ib); ++ k) {
+                    if (m.index2_data () [k] - ib >= i) {
+                        if (m.index2_data () [k] - ib == i)
+                            diagonal [i] = k;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Eliminate row i of an ILU(0) factorization; rows of its lower
+        // pattern must be finished. work maps columns to positions in row i
+        // and must hold nnz () everywhere on entry; it is restored on exit.
+        template<class M, class PA>
+        bool ilu0_row (M &m, typename M::size_type i, const PA &diagonal, PA &work) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type ib = M::index_base ();
+            const array_size_type none = m.nnz ();
+            const array_size_type begin = m.index1_data () [i] - ib;
+            const array_size_type end = m.index1_data () [i + 1] - ib;
+            bool regular = diagonal [i] != none;
+            for (array_size_type k = begin; k < end; ++ k)
+                work [m.index2_data () [k] - ib] = k;
+            for (array_size_type p = begin; p < end && m.index2_data () [p] - ib < i; ++ p) {
+                const size_type k = m.index2_data () [p] - ib;
+                if (diagonal [k] == none || m.value_data () [diagonal [k]] == value_type/*zero*/()) {
+                    regular = false;
+                    continue;
+                }
+                const value_type l = m.value_data () [p] /= m.value_data () [diagonal [k]];
+                const array_size_type k_end = m.index1_data () [k + 1] - ib;
+                for (array_size_type q = diagonal [k] + 1; q < k_end; ++ q) {
+                    const array_size_type w = work [m.index2_data () [q] - ib];
+                    if (w != none)
+                        m.value_data () [w] -= l * m.value_data () [q];
+                }
+            }
+            for (array_size_type k = begin; k < end; ++ k)
+                work [m.index2_data () [k] - ib] = none;
+            return regular && m.value_data () [diagonal [i]] != value_type/*zero*/();
+        }
+
+        // Compute row i of the IC(0) factor L from the lower triangle of m.
+        // Same contract for work as ilu0_row.
+        template<class M, class PA>
+        bool ic0_row (M &m, typename M::size_type i, const PA &diagonal, PA &work) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type ib = M::index_base ();
+            const array_size_type none = m.nnz ();
+            const array_size_type begin = m.index1_data () [i] - ib;
+            if (diagonal [i] == none)
+                return false;
+            for (array_size_type k = begin; k < diagonal [i]; ++ k)
+                work [m.index2_data () [k] - ib] = k;
+            value_type d = m.value_data () [diagonal [i]];
+            bool regular = true;
+            for (array_size_type p = begin; p < diagonal [i]; ++ p) {
+                const size_type k = m.index2_data () [p] - ib;
+                // row k bounds the loop below by its diagonal
+                if (diagonal [k] == none || m.value_data () [diagonal [k]] == value_type/*zero*/()) {
+                    regular = false;
+                    continue;
+                }
+                value_type t = m.value_data () [p];
+                for (array_size_type q = m.index1_data () [k] - ib; q < diagonal [k]; ++ q) {
+                    const array_size_type w = work [m.index2_data () [q] - ib];
+                    if (w != none)
+                        t -= m.value_data () [w] * m.value_data () [q];
+                }
+                t /= m.value_data () [diagonal [k]];
+                m.value_data () [p] = t;
+                d -= t * t;
+            }
+            for (array_size_type k = begin; k < diagonal [i]; ++ k)
+                work [m.index2_data () [k] - ib] = none;
+            if (! (d > value_type/*zero*/()))
+                return false;
+            m.value_data () [diagonal [i]] = type_traits<value_type>::type_sqrt (d);
+            return regular;
+        }
+
+        // Copy the strict lower triangle into the strict upper triangle (L^T).
+        // Precondition: the pattern is symmetric. Row cursors avoid any search, so a
+        // non symmetric pattern is only detected when BOOST_UBLAS_CHECK is enabled
+        // and otherwise gives a wrong upper triangle.
+        template<class M, class PA>
+        void mirror_lower (M &m, const PA &diagonal) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+
+            const size_type ib = M::index_base ();
+            PA cursor (m.size1 ());
+            for (size_type i = 0; i < m.size1 (); ++ i)
+                cursor [i] = diagonal [i] + 1;
+            for (size_type i = 0; i < m.size1 (); ++ i) {
+                for (array_size_type p = m.index1_data () [i] - ib; p < diagonal [i]; ++ p) {
+                    const size_type k = m.index2_data () [p] - ib;
+                    BOOST_UBLAS_CHECK (cursor [k] < array_size_type (m.index1_data () [k + 1] - ib) &&
+                                       m.index2_data () [cursor [k]] - ib == i, external_logic ());
+                    m.value_data () [cursor [k] ++] = m.value_data () [p];
+                }
+            }
+#if BOOST_UBLAS_CHECK_ENABLE
+            // every element of the upper triangle has been written
+            for (size_type i = 0; i < m.size1 (); ++ i) {
+                BOOST_UBLAS_CHECK (cursor [i] == array_size_type (m.index1_data () [i + 1] - ib), external_logic ());
+            }
+#endif
+        }
+
+        // Reduce the column list c to the n entries of largest magnitude in w
+        template<class V>
+        struct greater_magnitude {
+            greater_magnitude (const V &w): w_ (w) {}
+            template<class I>
+            bool operator () (I i, I j) const {
+                return type_traits<typename V::value_type>::type_abs (w_ [i]) >
+                       type_traits<typename V::value_type>::type_abs (w_ [j]);
+            }
+            const V &w_;
+        };
+        template<class C, class V>
+        void keep_largest (C &c, const V &w, typename C::size_type n) {
+            if (c.size () <= n)
+                return;
+            std::nth_element (c.begin (), c.begin () + n, c.end (), greater_magnitude<V> (w));
+            c.resize (n);
+        }
+
+        template<class M, class E>
+        void csr_lower_solve (const M &m, vector_expression<E> &e, bool unit) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+            typedef typename E::value_type value_type;
+
+            const size_type ib = M::index_base ();
+            for (size_type i = 0; i < e ().size (); ++ i) {
+                value_type t = e () (i);
+                array_size_type p = m.index1_data () [i] - ib;
+                const array_size_type end = m.index1_data () [i + 1] - ib;
+                for (; p < end && m.index2_data () [p] - ib < i; ++ p)
+                    t -= m.value_data () [p] * e () (m.index2_data () [p] - ib);
+                if (! unit) {
+                    BOOST_UBLAS_CHECK (p < end && m.index2_data () [p] - ib == i, singular ());
+                    t /= m.value_data () [p];
+                }
+                e () (i) = t;
+            }
+        }
+
+        template<class M, class E>
+        void csr_upper_solve (const M &m, vector_expression<E> &e, bool unit) {
+            typedef typename M::size_type size_type;
+            typedef typename M::array_size_type array_size_type;
+            typedef typename E::value_type value_type;
+
+            const size_type ib = M::index_base ();
+            for (size_type i = e ().size (); i-- > 0; ) {
+                value_type t = e () (i);
+                const array_size_type begin = m.index1_data () [i] - ib;
+                array_size_type p = m.index1_data () [i + 1] - ib;
+                for (; p > begin && m.index2_data () [p - 1] - ib > i; -- p)
+                    t -= m.value_data () [p - 1] * e () (m.index2_data () [p - 1] - ib);
+                if (! unit) {
+                    BOOST_UBLAS_CHECK (p > begin && m.index2_data () [p - 1] - ib == i, singular ());
+                    t /= m.value_data () [p - 1];
+                }
+                e () (i) = t;
+            }
+        }
+
+    }
+
+    // ILU(0) factorization: no fill outside the pattern of m
+    template<class M>
+    typename M::size_type ilu0_factorize (M &m) {
+        typedef typename M::size_type size_type;
+        typedef unbounded_array<typename M::array_size_type> ptr_array_type;
+
+        BOOST_STATIC_ASSERT ((boost::is_same<typename M::orientation_category, row_major_tag>::value));
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        m.complete_index1_data ();
+        size_type singular = 0;
+        ptr_array_type diagonal (m.size1 ());
+        ptr_array_type work (m.size2 (), m.nnz ());
+        detail::compressed_diagonal (m, diagonal);
+        for (size_type i = 0; i < m.size1 (); ++ i) {
+            if (! detail::ilu0_row (m, i, diagonal, work) && singular == 0)
+                singular = i + 1;
+        }
+        return singular;
+    }
+
+    // ILU(0) factorization, rows of one level of the lower schedule in parallel
+    template<class M>
+    typename M::size_type ilu0_factorize (M &m, const level_schedule<M, lower_tag> &s) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef unbounded_array<array_size_type> ptr_array_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == s.size () && m.nnz () == s.nnz (), bad_size ());
+        m.complete_index1_data ();
+        size_type singular = 0;
+#pragma omp parallel
+        {
+            ptr_array_type work (m.size2 (), m.nnz ());
+            for (size_type l = 0; l < s.levels (); ++ l) {
+#pragma omp for
+                for (array_size_type p = s.level_ptr () [l]; p < s.level_ptr () [l + 1]; ++ p) {
+                    const size_type i = s.level_data () [p];
+                    if (! detail::ilu0_row (m, i, s.diagonal_data (), work)) {
+#pragma omp critical
+                        if (singular == 0 || i + 1 < singular)
+                            singular = i + 1;
+                    }
+                }
+            }
+        }
+        return singular;
+    }
+
+    /** \brief ILUT(p, tau) factorization with dual threshold dropping.
+     *
+     * Fill-ins smaller than \c tau times the 2-norm of the current row are
+     * dropped and at most \c fill entries are kept in each of the L and U parts
+     * of a row. The pattern changes, so the factor replaces the storage of \c m.
+     */
+    template<class M>
+    typename M::size_type ilut_factorize (M &m, typename type_traits<typename M::value_type>::real_type tau,
+                                          typename M::size_type fill) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef typename M::value_type value_type;
+        typedef typename type_traits<value_type>::real_type real_type;
+        typedef unbounded_array<array_size_type> ptr_array_type;
+
+        BOOST_STATIC_ASSERT ((boost::is_same<typename M::orientation_category, row_major_tag>::value));
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        m.complete_index1_data ();
+        const size_type ib = M::index_base ();
+        const size_type size = m.size1 ();
+        const size_type none = size;
+        size_type singular = 0;
+
+        M r (size, size, m.nnz ());
+        ptr_array_type diagonal (size);
+        unbounded_array<value_type> w (size, value_type/*zero*/());
+        unbounded_array<size_type> marker (size, none);
+        std::vector<size_type> nz, lower, upper;
+        std::vector<size_type> heap;
+        for (size_type i = 0; i < size; ++ i) {
+            nz.clear ();
+            heap.clear ();
+            real_type norm = real_type/*zero*/();
+            for (array_size_type k = m.index1_data () [i] - ib; k < array_size_type (m.index1_data () [i + 1] - ib); ++ k) {
+                const size_type j = m.index2_data () [k] - ib;
+                w [j] = m.value_data () [k];
+                marker [j] = i;
+                nz.push_back (j);
+                if (j < i)
+                    heap.push_back (j);
+                norm += type_traits<value_type>::type_abs (w [j]) * type_traits<value_type>::type_abs (w [j]);
+            }
+            if (marker [i] != i) {
+                w [i] = value_type/*zero*/();
+                marker [i] = i;
+                nz.push_back (i);
+            }
+            const real_type tol = tau * type_traits<real_type>::type_sqrt (norm);
+
+            // Eliminate with the finished rows in increasing column order
+            std::make_heap (heap.begin (), heap.end (), std::greater<size_type> ());
+            while (! heap.empty ()) {
+                std::pop_heap (heap.begin (), heap.end (), std::greater<size_type> ());
+                const size_type k = heap.back ();
+                heap.pop_back ();
+                const value_type pivot = r.value_data () [diagonal [k]];
+                if (pivot == value_type/*zero*/()) {
+                    w [k] = value_type/*zero*/();
+                    continue;
+                }
+                const value_type l = w [k] /= pivot;
+                if (type_traits<value_type>::type_abs (l) < tol) {
+                    w [k] = value_type/*zero*/();
+                    continue;
+                }
+                const array_size_type k_end = r.index1_data () [k + 1] - ib;
+                for (array_size_type q = diagonal [k] + 1; q < k_end; ++ q) {
+                    const size_type j = r.index2_data () [q] - ib;
+                    if (marker [j] != i) {
+                        w [j] = value_type/*zero*/();
+                        marker [j] = i;
+                        nz.push_back (j);
+                        if (j < i) {
+                            heap.push_back (j);
+                            std::push_heap (heap.begin (), heap.end (), std::greater<size_type> ());
+                        }
+                    }
+                    w [j] -= l * r.value_data () [q];
+                }
+            }
+
+            // Drop small entries and keep the fill largest of each part
+            lower.clear ();
+            upper.clear ();
+            for (size_type n = 0; n < nz.size (); ++ n) {
+                const size_type j = nz [n];
+                if (j != i && type_traits<value_type>::type_abs (w [j]) >= tol && w [j] != value_type/*zero*/())
+                    (j < i ? lower : upper).push_back (j);
+            }
+            detail::keep_largest (lower, w, fill);
+            detail::keep_largest (upper, w, fill);
+            std::sort (lower.begin (), lower.end ());
+            std::sort (upper.begin (), upper.end ());
+
+            for (size_type n = 0; n < lower.size (); ++ n)
+                r.push_back (i, lower [n], w [lower [n]]);
+            if (w [i] == value_type/*zero*/() && singular == 0)
+                singular = i + 1;
+            diagonal [i] = r.nnz ();
+            r.push_back (i, i, w [i]);
+            for (size_type n = 0; n < upper.size (); ++ n)
+                r.push_back (i, upper [n], w [upper [n]]);
+            for (size_type n = 0; n < nz.size (); ++ n)
+                w [nz [n]] = value_type/*zero*/();
+        }
+        r.complete_index1_data ();
+        m.swap (r);
+        return singular;
+    }
+
+    // IC(0) factorization of a symmetric positive definite matrix with symmetric pattern.
+    // Returns the first row with a non positive pivot, 0 on success.
+    // A non symmetric pattern is only detected when BOOST_UBLAS_CHECK is enabled.
+    template<class M>
+    typename M::size_type ic0_factorize (M &m) {
+        typedef typename M::size_type size_type;
+        typedef unbounded_array<typename M::array_size_type> ptr_array_type;
+
+        BOOST_STATIC_ASSERT ((boost::is_same<typename M::orientation_category, row_major_tag>::value));
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        m.complete_index1_data ();
+        size_type singular = 0;
+        ptr_array_type diagonal (m.size1 ());
+        ptr_array_type work (m.size2 (), m.nnz ());
+        detail::compressed_diagonal (m, diagonal);
+        for (size_type i = 0; i < m.size1 (); ++ i) {
+            if (! detail::ic0_row (m, i, diagonal, work) && singular == 0)
+                singular = i + 1;
+        }
+        if (singular == 0)
+            detail::mirror_lower (m, diagonal);
+        return singular;
+    }
+
+    // IC(0) factorization, rows of one level of the lower schedule in parallel
+    template<class M>
+    typename M::size_type ic0_factorize (M &m, const level_schedule<M, lower_tag> &s) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef unbounded_array<array_size_type> ptr_array_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == s.size () && m.nnz () == s.nnz (), bad_size ());
+        m.complete_index1_data ();
+        size_type singular = 0;
+#pragma omp parallel
+        {
+            ptr_array_type work (m.size2 (), m.nnz ());
+            for (size_type l = 0; l < s.levels (); ++ l) {
+#pragma omp for
+                for (array_size_type p = s.level_ptr () [l]; p < s.level_ptr () [l + 1]; ++ p) {
+                    const size_type i = s.level_data () [p];
+                    if (! detail::ic0_row (m, i, s.diagonal_data (), work)) {
+#pragma omp critical
+                        if (singular == 0 || i + 1 < singular)
+                            singular = i + 1;
+                    }
+                }
+            }
+        }
+        if (singular == 0)
+            detail::mirror_lower (m, s.diagonal_data ());
+        return singular;
+    }
+
+    // ILU substitution: solve L U x = e in place
+    template<class M, class E>
+    void ilu_substitute (const M &m, vector_expression<E> &e) {
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size (), bad_size ());
+        detail::csr_lower_solve (m, e, true);
+        detail::csr_upper_solve (m, e, false);
+    }
+    template<class M, class E>
+    void ilu_substitute (const M &m,
+                         const level_schedule<M, unit_lower_tag> &ls,
+                         const level_schedule<M, upper_tag> &us,
+                         vector_expression<E> &e) {
+        inplace_solve (m, e, ls);
+        inplace_solve (m, e, us);
+    }
+
+    // IC substitution: solve L L^T x = e in place
+    template<class M, class E>
+    void ic_substitute (const M &m, vector_expression<E> &e) {
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size (), bad_size ());
+        detail::csr_lower_solve (m, e, false);
+        detail::csr_upper_solve (m, e, false);
+    }
+    template<class M, class E>
+    void ic_substitute (const M &m,
+                        const level_schedule<M, lower_tag> &ls,
+                        const level_schedule<M, upper_tag> &us,
+                        vector_expression<E> &e) {
+        inplace_solve (m, e, ls);
+        inplace_solve (m, e, us);
+    }
+
+}}}
+
+#endif
@@ -18,6 +18,11 @@
 #include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+
+#include <cmath>
+#include <limits>
 
 // LU factorizations in the spirit of LAPACK and Golub & van Loan
 
@@ -261,6 +266,268 @@ namespace boost { namespace numeric { namespace ublas {
         return singular;
     }
 
+    namespace detail {
+
+        // Blocked LU factorization of block_lu_factorize. With fixed pivots the rows
+        // of m are already interchanged according to pm and the diagonal elements
+        // are taken as pivots, until one of them falls below 1 / growth times the
+        // largest element beneath it; from that column on the pivots are searched.
+        template<class M, class PM>
+        typename M::size_type block_lu_factorize (M &m, PM &pm, typename M::size_type block_size, bool fixed,
+                                                  typename type_traits<typename M::value_type>::real_type growth) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+            typedef typename type_traits<value_type>::real_type real_type;
+
+            BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+            size_type singular = 0;
+            const size_type size1 = m.size1 ();
+            const size_type size2 = m.size2 ();
+            const size_type size = (std::min) (size1, size2);
+            for (size_type k0 = 0; k0 < size; k0 += block_size) {
+                const size_type k1 = (std::min) (size, size_type (k0 + block_size));
+
+                // Panel factorization, rows are interchanged over the whole width
+                for (size_type j = k0; j < k1; ++ j) {
+                    if (fixed) {
+                        // Keep the diagonal pivot unless an element below it is larger by the growth factor
+                        const real_type bound = growth * type_traits<value_type>::norm_inf (m (j, j));
+                        size_type exceeding = 0;
+#pragma omp parallel for reduction (+:exceeding) if (size1 - j > kernel_parallel_work / 64)
+                        for (size_type i = j + 1; i < size1; ++ i)
+                            if (type_traits<value_type>::norm_inf (m (i, j)) > bound)
+                                ++ exceeding;
+                        if (exceeding != 0) {
+                            // Undo the interchanges of the remaining columns and search the pivots from here on
+                            for (size_type i = pm.size (); i > j; -- i)
+                                if (pm (i - 1) != i - 1) {
+                                    row (m, pm (i - 1)).swap (row (m, i - 1));
+                                    pm (i - 1) = i - 1;
+                                }
+                            fixed = false;
+                        }
+                    }
+                    size_type j_norm_inf = j;
+                    if (! fixed) {
+                        matrix_column<M> mcj (column (m, j));
+                        j_norm_inf = j + index_norm_inf (project (mcj, range (j, size1)));
+                        BOOST_UBLAS_CHECK (j_norm_inf < size1, external_logic ());
+                    }
+                    if (m (j_norm_inf, j) != value_type/*zero*/()) {
+                        if (j_norm_inf != j) {
+                            pm (j) = j_norm_inf;
+                            row (m, j_norm_inf).swap (row (m, j));
+                        } else {
+                            BOOST_UBLAS_CHECK (fixed || pm (j) == j_norm_inf, external_logic ());
+                        }
+                        const value_type m_inv = value_type (1) / m (j, j);
+#pragma omp parallel for if ((size1 - j) * (k1 - j) > kernel_parallel_work)
+                        for (size_type i = j + 1; i < size1; ++ i) {
+                            const value_type l = m (i, j) *= m_inv;
+                            for (size_type c = j + 1; c < k1; ++ c)
+                                m (i, c) -= l * m (j, c);
+                        }
+                    } else {
+                        if (singular == 0)
+                            singular = j + 1;
+#pragma omp parallel for if ((size1 - j) * (k1 - j) > kernel_parallel_work)
+                        for (size_type i = j + 1; i < size1; ++ i) {
+                            const value_type l = m (i, j);
+                            for (size_type c = j + 1; c < k1; ++ c)
+                                m (i, c) -= l * m (j, c);
+                        }
+                    }
+                }
+                if (k1 >= size2)
+                    continue;
+
+                // Block row of the upper factor: solve with the unit lower diagonal block
+                const size_type blocks = (size2 - k1 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if ((size2 - k1) * (k1 - k0) * (k1 - k0) > kernel_parallel_work)
+                for (size_type block = 0; block < blocks; ++ block) {
+                    const size_type c0 = k1 + block * kernel_block_m;
+                    const size_type c1 = (std::min) (size2, size_type (c0 + kernel_block_m));
+                    for (size_type j = k0; j < k1; ++ j)
+                        for (size_type i = j + 1; i < k1; ++ i) {
+                            const value_type l = m (i, j);
+                            for (size_type c = c0; c < c1; ++ c)
+                                m (i, c) -= l * m (j, c);
+                        }
+                }
+
+                // Trailing update
+                if (k1 < size1) {
+                    matrix_range<M> a22 (m, range (k1, size1), range (k1, size2));
+                    block_gemm (a22, value_type (-1),
+                                matrix_range<M> (m, range (k1, size1), range (k0, k1)),
+                                matrix_range<M> (m, range (k0, k1), range (k1, size2)));
+                }
+            }
+            return singular;
+        }
+
+    }
+
+    /** \brief Blocked right looking LU factorization with partial pivoting.
+     *
+     * Computes the same factorization as lu_factorize (m, pm): the strict
+     * lower part of \c m holds the unit lower factor, the upper part the upper
+     * factor, and \c pm the row interchanges. The columns are processed in
+     * panels of \c block_size: each panel is factorized with partial pivoting,
+     * the corresponding block row of the upper factor is obtained by a
+     * triangular solve, and the trailing matrix receives a single matrix
+     * product update, computed in parallel. Intended for large dense matrices.
+     *
+     * \return 0 if \c m is nonsingular, else one plus the index of the first zero pivot.
+     */
+    template<class M, class PM>
+    typename M::size_type block_lu_factorize (M &m, PM &pm, typename M::size_type block_size = 64) {
+        return detail::block_lu_factorize (m, pm, block_size, false, typename type_traits<typename M::value_type>::real_type (1));
+    }
+
+    /** \brief LU refactorization reusing the row interchanges of a previous factorization.
+     *
+     * \c pm holds the interchanges of an earlier lu_factorize or
+     * block_lu_factorize of a matrix with the same structure, as in a Newton
+     * iteration whose Jacobian changes little between the steps. The rows of
+     * \c m are interchanged according to \c pm up front and the factorization
+     * proceeds like block_lu_factorize without pivot search. A pivot is
+     * rejected when some element below it is larger than \c growth times its
+     * magnitude, which bounds the multipliers of the lower factor by
+     * \c growth; from the rejected column on the interchanges still to come
+     * are undone and the pivots are searched again, and \c pm is updated
+     * accordingly. The default growth of 10 corresponds to a relative pivot
+     * tolerance of 0.1.
+     *
+     * \return 0 if \c m is nonsingular, else one plus the index of the first zero pivot.
+     */
+    template<class M, class PM>
+    typename M::size_type lu_refactorize (M &m, PM &pm,
+                                          typename type_traits<typename M::value_type>::real_type growth = 10,
+                                          typename M::size_type block_size = 64) {
+        BOOST_UBLAS_CHECK (growth >= 1, bad_argument ());
+        BOOST_UBLAS_CHECK (pm.size () <= m.size1 (), bad_size ());
+        swap_rows (pm, m);
+        return detail::block_lu_factorize (m, pm, block_size, true, growth);
+    }
+
+    /** \brief LU factorization with partial pivoting of a square banded matrix.
+     *
+     * Row interchanges let the upper factor grow by lower () bands, so the
+     * upper bandwidth of \c m is first widened to upper () + lower (), keeping
+     * its elements. On return the diagonal and the upper bands hold the upper
+     * factor, the lower bands the multipliers of the unit lower factor and
+     * \c pm the row interchanges. As in LAPACK's GBTRF an interchange is not
+     * applied to the multipliers of the columns already eliminated, which would
+     * move them out of the band, so the factors are to be used with
+     * banded_lu_substitute. Takes O(n * lower () * (lower () + upper ())) operations.
+     *
+     * \return 0 if \c m is nonsingular, else one plus the index of the first zero pivot.
+     */
+    template<class T, class L, class A, class PM>
+    typename banded_matrix<T, L, A>::size_type banded_lu_factorize (banded_matrix<T, L, A> &m, PM &pm) {
+        typedef typename banded_matrix<T, L, A>::size_type size_type;
+        typedef T value_type;
+        typedef typename type_traits<T>::real_type real_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (pm.size () == m.size1 (), bad_size ());
+        const size_type size = m.size1 (), lower = m.lower ();
+        if (lower > 0) {
+            banded_matrix<T, L, A> w (size, size, lower, m.upper () + lower);
+            w.clear ();
+            for (size_type i = 0; i < size; ++ i) {
+                const size_type first = i > lower ? i - lower : 0;
+                const size_type last = (std::min) (size, size_type (i + 1 + m.upper ()));
+                for (size_type j = first; j < last; ++ j)
+                    w (i, j) = m (i, j);
+            }
+            m.swap (w);
+        }
+        const size_type upper = m.upper ();
+        size_type singular = 0;
+        for (size_type j = 0; j < size; ++ j) {
+            const size_type last = (std::min) (size, size_type (j + 1 + lower));
+            const size_type columns = (std::min) (size, size_type (j + 1 + upper));
+            size_type p = j;
+            real_type p_norm = type_traits<value_type>::norm_inf (m (j, j));
+            for (size_type i = j + 1; i < last; ++ i) {
+                const real_type i_norm = type_traits<value_type>::norm_inf (m (i, j));
+                if (i_norm > p_norm) {
+                    p = i;
+                    p_norm = i_norm;
+                }
+            }
+            pm (j) = p;
+            if (p_norm == real_type/*zero*/()) {
+                // nothing to eliminate in this column
+                if (singular == 0)
+                    singular = j + 1;
+                continue;
+            }
+            if (p != j) {
+                for (size_type c = j; c < columns; ++ c)
+                    std::swap (m (p, c), m (j, c));
+            }
+            const value_type m_inv = value_type (1) / m (j, j);
+            for (size_type i = j + 1; i < last; ++ i)
+                m (i, j) *= m_inv;
+#pragma omp parallel for if ((last - j) * (columns - j) > detail::kernel_parallel_work)
+            for (size_type c = j + 1; c < columns; ++ c) {
+                const value_type u = m (j, c);
+                if (u != value_type/*zero*/()) {
+                    for (size_type i = j + 1; i < last; ++ i)
+                        m (i, c) -= m (i, j) * u;
+                }
+            }
+        }
+        return singular;
+    }
+
+    namespace detail {
+
+        // Unit lower factor of banded_lu_factorize, interchanges applied column by column
+        template<class M, class PM, class V>
+        void banded_lu_forward (const M &m, const PM &pm, V &v) {
+            typedef typename M::size_type size_type;
+            typedef typename V::value_type value_type;
+
+            const size_type size = m.size1 ();
+            for (size_type j = 0; j < size; ++ j) {
+                if (pm (j) != j)
+                    std::swap (v (j), v (pm (j)));
+                const value_type t = v (j);
+                if (t != value_type/*zero*/()) {
+                    const size_type last = (std::min) (size, size_type (j + 1 + m.lower ()));
+                    for (size_type i = j + 1; i < last; ++ i)
+                        v (i) -= m (i, j) * t;
+                }
+            }
+        }
+
+    }
+
+    // Banded LU substitution
+    template<class T, class L, class A, class PM, class E>
+    void banded_lu_substitute (const banded_matrix<T, L, A> &m, const PM &pm, vector_expression<E> &e) {
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size () && pm.size () == e ().size (), bad_size ());
+        detail::banded_lu_forward (m, pm, e ());
+        inplace_solve (m, e, upper_tag ());
+    }
+    template<class T, class L, class A, class PM, class E>
+    void banded_lu_substitute (const banded_matrix<T, L, A> &m, const PM &pm, matrix_expression<E> &e) {
+        typedef typename E::size_type size_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size1 () && pm.size () == e ().size1 (), bad_size ());
+        const size_type size2 = e ().size2 ();
+#pragma omp parallel for if (size2 > 1 && double (e ().size1 ()) * m.lower () * size2 > double (detail::kernel_parallel_work))
+        for (size_type c = 0; c < size2; ++ c) {
+            matrix_column<E> v (e (), c);
+            detail::banded_lu_forward (m, pm, v);
+        }
+        inplace_solve (m, e, upper_tag ());
+    }
+
     // LU substitution
     template<class M, class E>
     void lu_substitute (const M &m, vector_expression<E> &e) {
@@ -345,6 +612,266 @@ namespace boost { namespace numeric { namespace ublas {
         lu_substitute (mv, m);
     }
 
+    namespace detail {
+
+        // Inverse of the upper triangle of m in place, as LAPACK's TRTRI. Each
+        // block column above the diagonal is multiplied by the inverted leading
+        // triangle, block row by block row, and solved with its diagonal block.
+        template<class M>
+        typename M::size_type upper_inverse (M &m, typename M::size_type block_size) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size = m.size1 ();
+            for (size_type i = 0; i < size; ++ i)
+                if (m (i, i) == value_type/*zero*/())
+                    return i + 1;
+            matrix<value_type> x;
+            for (size_type j0 = 0; j0 < size; j0 += block_size) {
+                const size_type j1 = (std::min) (size, size_type (j0 + block_size)), jb = j1 - j0;
+                // m (0:j0, j0:j1) = inverse (U11) m (0:j0, j0:j1), top down so the rows below are still unchanged
+                for (size_type i0 = 0; i0 < j0; i0 += block_size) {
+                    const size_type i1 = (std::min) (j0, size_type (i0 + block_size));
+                    x.resize (i1 - i0, jb, false);
+                    for (size_type i = i0; i < i1; ++ i)
+                        for (size_type c = j0; c < j1; ++ c) {
+                            value_type s = value_type/*zero*/();
+                            for (size_type p = i; p < i1; ++ p)
+                                s += m (i, p) * m (p, c);
+                            x (i - i0, c - j0) = s;
+                        }
+                    if (i1 < j0)
+                        block_gemm (x, value_type (1),
+                                    matrix_range<M> (m, range (i0, i1), range (i1, j0)),
+                                    matrix_range<M> (m, range (i1, j0), range (j0, j1)));
+                    project (m, range (i0, i1), range (j0, j1)).assign (x);
+                }
+                // m (0:j0, j0:j1) = - m (0:j0, j0:j1) inverse (U22)
+#pragma omp parallel for if (j0 * jb * jb > kernel_parallel_work)
+                for (size_type i = 0; i < j0; ++ i)
+                    for (size_type c = j0; c < j1; ++ c) {
+                        value_type s = - m (i, c);
+                        for (size_type p = j0; p < c; ++ p)
+                            s -= m (i, p) * m (p, c);
+                        m (i, c) = s / m (c, c);
+                    }
+                // U22 itself, column by column
+                for (size_type c = j0; c < j1; ++ c) {
+                    m (c, c) = value_type (1) / m (c, c);
+                    const value_type mcc = - m (c, c);
+                    for (size_type i = j0; i < c; ++ i) {
+                        value_type s = value_type/*zero*/();
+                        for (size_type p = i; p < c; ++ p)
+                            s += m (i, p) * m (p, c);
+                        m (i, c) = mcc * s;
+                    }
+                }
+            }
+            return 0;
+        }
+
+        // Inverse from the LU factors in place, as LAPACK's GETRI: inverse (U) is
+        // formed in the upper triangle, then X L = inverse (U) is solved for
+        // X = inverse (A) P' block column by block column from the right, the
+        // columns of L being moved into work first.
+        template<class M, class PM, class W>
+        typename M::size_type lu_inverse (M &m, const PM &pm, W &work, typename M::size_type block_size) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+            BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+            const size_type size = m.size1 ();
+            if (size == 0)
+                return 0;
+            const size_type info = upper_inverse (m, block_size);
+            if (info != 0)
+                return info;
+            work.resize (size, block_size, false);
+            for (size_type j0 = ((size - 1) / block_size) * block_size; ; j0 -= block_size) {
+                const size_type j1 = (std::min) (size, size_type (j0 + block_size)), jb = j1 - j0;
+                for (size_type j = j0; j < j1; ++ j)
+                    for (size_type i = j + 1; i < size; ++ i) {
+                        work (i, j - j0) = m (i, j);
+                        m (i, j) = value_type/*zero*/();
+                    }
+                matrix_range<M> mj (m, range (0, size), range (j0, j1));
+                if (j1 < size)
+                    block_gemm (mj, value_type (-1),
+                                matrix_range<M> (m, range (0, size), range (j1, size)),
+                                matrix_range<W> (work, range (j1, size), range (0, jb)));
+                // mj = mj inverse (L22), L22 unit lower
+#pragma omp parallel for if (size * jb * jb > kernel_parallel_work)
+                for (size_type i = 0; i < size; ++ i)
+                    for (size_type c = j1; c -- > j0; ) {
+                        value_type s = m (i, c);
+                        for (size_type r = c + 1; r < j1; ++ r)
+                            s -= m (i, r) * work (r, c - j0);
+                        m (i, c) = s;
+                    }
+                if (j0 == 0)
+                    break;
+            }
+            for (size_type j = pm.size (); j -- > 0; )
+                if (pm (j) != j)
+                    column (m, j).swap (column (m, pm (j)));
+            return 0;
+        }
+
+    }
+
+    /** \brief Inverse of a matrix from its LU factors, in place.
+     *
+     * \c m and \c pm are the result of lu_factorize or block_lu_factorize. The
+     * upper factor is inverted in place and the inverse is obtained from it
+     * and the lower factor without a right hand side, as LAPACK's GETRI, with
+     * the products in blocks of \c block_size columns; only a block of columns
+     * of the lower factor is copied aside.
+     *
+     * \return 0 on success, else one plus the index of the first zero pivot; \c m is then left unchanged.
+     */
+    template<class M, class PM>
+    typename M::size_type lu_inverse (M &m, const PM &pm, typename M::size_type block_size = 64) {
+        matrix<typename M::value_type> work;
+        return detail::lu_inverse (m, pm, work, block_size);
+    }
+
+    /** \brief Storage reused by inplace_inverse: the row interchanges and a block of columns.
+     *
+     * \tparam T the value type of the matrices to invert
+     */
+    template<class T>
+    class inverse_workspace {
+    public:
+        typedef std::size_t size_type;
+        typedef permutation_matrix<size_type> pivots_type;
+        typedef matrix<T> columns_type;
+
+        // Construction and destruction
+        BOOST_UBLAS_INLINE
+        inverse_workspace ():
+            pivots_ (0), columns_ () {}
+
+        // Accessors
+        BOOST_UBLAS_INLINE
+        pivots_type &pivots () {
+            return pivots_;
+        }
+        BOOST_UBLAS_INLINE
+        columns_type &columns () {
+            return columns_;
+        }
+
+    private:
+        pivots_type pivots_;
+        columns_type columns_;
+    };
+
+    /** \brief Inverts a square matrix in place.
+     *
+     * Factorizes \c m by block_lu_factorize and overwrites it with its inverse
+     * by lu_inverse. The pivots and the column block come from \c w, so that
+     * repeated inversions of matrices of the same order allocate nothing.
+     *
+     * \return 0 on success, else one plus the index of the first zero pivot; \c m then holds its LU factors.
+     */
+    template<class M, class T>
+    typename M::size_type inplace_inverse (M &m, inverse_workspace<T> &w, typename M::size_type block_size = 64) {
+        typedef typename M::size_type size_type;
+        typedef typename inverse_workspace<T>::pivots_type pivots_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+        const size_type size = m.size1 ();
+        pivots_type &pm = w.pivots ();
+        if (pm.size () != size)
+            pm.resize (size, false);
+        for (size_type i = 0; i < size; ++ i)
+            pm (i) = i;
+        const size_type info = block_lu_factorize (m, pm, block_size);
+        if (info != 0)
+            return info;
+        return detail::lu_inverse (m, pm, w.columns (), block_size);
+    }
+
+    /** \brief Inverse of a square matrix.
+     *
+     * \throw singular if the matrix is singular.
+     */
+    template<class E>
+    matrix<typename E::value_type> inverse (const matrix_expression<E> &e) {
+        typedef typename E::value_type value_type;
+
+        matrix<value_type> m (e ());
+        inverse_workspace<value_type> w;
+        if (inplace_inverse (m, w) != 0)
+            singular ().raise ();
+        return m;
+    }
+
+    /** \brief Determinant of a square matrix, from its LU factorization.
+     *
+     * The product of the pivots may overflow or underflow for large matrices,
+     * see log_abs_determinant.
+     */
+    template<class E>
+    typename E::value_type determinant (const matrix_expression<E> &e) {
+        typedef typename E::size_type size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e ().size1 () == e ().size2 (), bad_size ());
+        const size_type size = e ().size1 ();
+        matrix<value_type> m (e ());
+        permutation_matrix<size_type> pm (size);
+        if (block_lu_factorize (m, pm) != 0)
+            return value_type/*zero*/();
+        value_type det (1);
+        for (size_type i = 0; i < size; ++ i) {
+            det *= m (i, i);
+            if (pm (i) != i)
+                det = - det;
+        }
+        return det;
+    }
+
+    /** \brief Logarithm of the absolute value of the determinant of a square matrix.
+     *
+     * Sums the logarithms of the magnitudes of the pivots, so that the result
+     * is meaningful where the determinant itself is not representable, e.g.
+     * for the likelihood of a Gaussian. \c sign receives det / |det|, or zero
+     * for a singular matrix, whose result is minus infinity.
+     */
+    template<class E>
+    typename type_traits<typename E::value_type>::real_type log_abs_determinant (const matrix_expression<E> &e, typename E::value_type &sign) {
+        typedef typename E::size_type size_type;
+        typedef typename E::value_type value_type;
+        typedef typename type_traits<value_type>::real_type real_type;
+        using std::log;
+
+        BOOST_UBLAS_CHECK (e ().size1 () == e ().size2 (), bad_size ());
+        const size_type size = e ().size1 ();
+        matrix<value_type> m (e ());
+        permutation_matrix<size_type> pm (size);
+        if (block_lu_factorize (m, pm) != 0) {
+            sign = value_type/*zero*/();
+            return - std::numeric_limits<real_type>::infinity ();
+        }
+        real_type result = real_type/*zero*/();
+        sign = value_type (1);
+        for (size_type i = 0; i < size; ++ i) {
+            const real_type magnitude = type_traits<value_type>::type_abs (m (i, i));
+            result += log (magnitude);
+            sign *= m (i, i) / magnitude;
+            if (pm (i) != i)
+                sign = - sign;
+        }
+        return result;
+    }
+    template<class E>
+    typename type_traits<typename E::value_type>::real_type log_abs_determinant (const matrix_expression<E> &e) {
+        typename E::value_type sign;
+        return log_abs_determinant (e, sign);
+    }
+
 }}}
 
 #endif
@@ -2883,6 +2883,34 @@ namespace boost { namespace numeric { namespace ublas {
             storage_invariants ();
         }
 
+        // Finalise a mapped_matrix of the same orientation in a single pass.
+        // The keys of the map are linearised indices, so once the map is
+        // sorted (hash_map_array sorts lazily here) they enumerate the
+        // elements in compressed order.
+        template<class A>
+        compressed_matrix (const mapped_matrix<T, L, A> &m):
+            matrix_container<self_type> (),
+            size1_ (m.size1 ()), size2_ (m.size2 ()), capacity_ (restrict_capacity (m.nnz ())),
+            filled1_ (layout_type::size_M (size1_, size2_) + 1), filled2_ (m.nnz ()),
+            index1_data_ (layout_type::size_M (size1_, size2_) + 1), index2_data_ (capacity_), value_data_ (capacity_) {
+            typedef typename mapped_matrix<T, L, A>::array_type::const_iterator const_map_iterator;
+            const size_type size_M = layout_type::size_M (size1_, size2_);
+            const size_type size_m = layout_type::size_m (size1_, size2_);
+            const_map_iterator it (m.data ().begin ());
+            size_type r = 0;
+            index1_data_ [0] = k_based (0);
+            for (size_type k = 0; k < filled2_; ++ k, ++ it) {
+                const size_type element1 = it->first / size_m;
+                while (r < element1)
+                    index1_data_ [++ r] = k_based (k);
+                index2_data_ [k] = k_based (it->first % size_m);
+                value_data_ [k] = it->second;
+            }
+            while (r < size_M)
+                index1_data_ [++ r] = k_based (filled2_);
+            storage_invariants ();
+        }
+
        template<class AE>
        BOOST_UBLAS_INLINE
        compressed_matrix (const matrix_expression<AE> &ae, size_type non_zeros = 0):
@@ -14,6 +14,8 @@
 #define _BOOST_UBLAS_OPERATION_
 
 #include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 /** \file operation.hpp
  *  \brief This file contains some specialized products.
@@ -715,6 +717,709 @@ namespace boost { namespace numeric { namespace ublas {
         return axpy_prod (e1, e2, m, full (), true);
     }
 
+    namespace detail {
+
+        // Number of right hand side columns updated per sweep over a sparse line.
+        // The block of the result row stays in the first level cache while the
+        // elements of the sparse line are streamed.
+        static const std::size_t spmm_column_block = 64;
+        // Minimum number of stored elements per work item
+        static const std::size_t spmm_grain = 4096;
+
+        // Split the major lines of a compressed matrix into ranges holding
+        // about the same number of stored elements: range p is [bounds [p], bounds [p + 1])
+        template<class T, class L, std::size_t IB, class IA, class TA>
+        void
+        compressed_partition (const compressed_matrix<T, L, IB, IA, TA> &e,
+                              unbounded_array<typename IA::value_type> &bounds) {
+            typedef typename IA::value_type size_type;
+
+            const size_type lines = e.filled1 () - 1;
+            const size_type parts = (std::max) (size_type (1), (std::min) (lines, size_type (e.nnz () / spmm_grain)));
+            bounds.resize (parts + 1);
+            bounds [0] = 0;
+            for (size_type p = 1; p < parts; ++ p) {
+                const size_type target = size_type (IB + e.nnz () * p / parts);
+                bounds [p] = std::lower_bound (e.index1_data ().begin () + bounds [p - 1], e.index1_data ().begin () + lines, target) - e.index1_data ().begin ();
+            }
+            bounds [parts] = lines;
+        }
+
+        // The sparse times dense kernels update every column of a result row,
+        // which is only sensible (and thread safe) for dense storage
+        template<class M, class E2>
+        struct spmm_dense_operands {
+            static const bool value =
+                is_convertible<typename M::storage_category, dense_proxy_tag>::value &&
+                is_convertible<typename E2::storage_category, dense_proxy_tag>::value;
+        };
+
+    }
+
+    // Sparse times dense product, one stored element updates a block of a result row
+    template<class M, class T1, class L1, std::size_t IB1, class IA1, class TA1, class E2>
+    M &
+    axpy_prod (const compressed_matrix<T1, L1, IB1, IA1, TA1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, row_major_tag) {
+        typedef typename IA1::value_type size_type;
+        typedef typename IA1::size_type array_size_type;
+        typedef typename M::value_type value_type;
+
+        const size_type size2 = m.size2 ();
+        unbounded_array<size_type> bounds;
+        detail::compressed_partition (e1, bounds);
+        const size_type parts = bounds.size () - 1;
+#pragma omp parallel for schedule(dynamic)
+        for (size_type p = 0; p < parts; ++ p) {
+            for (size_type i = bounds [p]; i < bounds [p + 1]; ++ i) {
+                const array_size_type begin = e1.index1_data () [i] - IB1;
+                const array_size_type end = e1.index1_data () [i + 1] - IB1;
+                for (size_type c0 = 0; c0 < size2; c0 += detail::spmm_column_block) {
+                    const size_type c1 = (std::min) (size2, size_type (c0 + detail::spmm_column_block));
+                    for (array_size_type k = begin; k < end; ++ k) {
+                        const value_type a = e1.value_data () [k];
+                        const size_type j = e1.index2_data () [k] - IB1;
+                        for (size_type c = c0; c < c1; ++ c)
+                            m (i, c) += a * e2 () (j, c);
+                    }
+                }
+            }
+        }
+        return m;
+    }
+
+    // Row major dense operands are accessed through contiguous rows
+    template<class T, class A, class T1, class L1, std::size_t IB1, class IA1, class TA1, class T2, class A2>
+    matrix<T, row_major, A> &
+    axpy_prod (const compressed_matrix<T1, L1, IB1, IA1, TA1> &e1,
+               const matrix<T2, row_major, A2> &e2,
+               matrix<T, row_major, A> &m, row_major_tag) {
+        typedef typename IA1::value_type size_type;
+        typedef typename IA1::size_type array_size_type;
+        typedef T value_type;
+
+        const size_type size2 = m.size2 ();
+        if (size2 == 0 || e2.size1 () == 0)
+            return m;
+        unbounded_array<size_type> bounds;
+        detail::compressed_partition (e1, bounds);
+        const size_type parts = bounds.size () - 1;
+        const T2 *b = &e2.data () [0];
+        T *r = &m.data () [0];
+#pragma omp parallel for schedule(dynamic)
+        for (size_type p = 0; p < parts; ++ p) {
+            for (size_type i = bounds [p]; i < bounds [p + 1]; ++ i) {
+                const array_size_type begin = e1.index1_data () [i] - IB1;
+                const array_size_type end = e1.index1_data () [i + 1] - IB1;
+                T *ri = r + i * size2;
+                for (size_type c0 = 0; c0 < size2; c0 += detail::spmm_column_block) {
+                    const size_type nc = (std::min) (size_type (size2 - c0), size_type (detail::spmm_column_block));
+                    T *rc = ri + c0;
+                    for (array_size_type k = begin; k < end; ++ k) {
+                        const value_type a = e1.value_data () [k];
+                        const T2 *bc = b + (e1.index2_data () [k] - IB1) * size2 + c0;
+                        for (size_type c = 0; c < nc; ++ c)
+                            rc [c] += a * bc [c];
+                    }
+                }
+            }
+        }
+        return m;
+    }
+
+    // Column major sparse operand: threads own disjoint blocks of result columns
+    template<class M, class T1, class L1, std::size_t IB1, class IA1, class TA1, class E2>
+    M &
+    axpy_prod (const compressed_matrix<T1, L1, IB1, IA1, TA1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, column_major_tag) {
+        typedef typename IA1::value_type size_type;
+        typedef typename IA1::size_type array_size_type;
+        typedef typename M::value_type value_type;
+
+        const size_type lines = e1.filled1 () - 1;
+        const size_type size2 = m.size2 ();
+        const size_type blocks = (size2 + detail::spmm_column_block - 1) / detail::spmm_column_block;
+#pragma omp parallel for
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type c0 = block * detail::spmm_column_block;
+            const size_type c1 = (std::min) (size2, size_type (c0 + detail::spmm_column_block));
+            for (size_type j = 0; j < lines; ++ j) {
+                for (array_size_type k = e1.index1_data () [j] - IB1; k < array_size_type (e1.index1_data () [j + 1] - IB1); ++ k) {
+                    const value_type a = e1.value_data () [k];
+                    const size_type i = e1.index2_data () [k] - IB1;
+                    for (size_type c = c0; c < c1; ++ c)
+                        m (i, c) += a * e2 () (j, c);
+                }
+            }
+        }
+        return m;
+    }
+
+  /** \brief computes <tt>M += A X</tt> or <tt>M = A X</tt> for a compressed matrix \c A
+          and a dense matrix \c X.
+
+          Each sparse line is read once per block of 64 columns of \c X,
+          which covers the whole right hand side for up to 64 columns.
+          A row major \c A is split into ranges of rows holding about the
+          same number of stored elements, which are processed in parallel.
+
+          Only used when both \c X and \c M have dense storage, sparse
+          operands or results take the generic sparse \c axpy_prod.
+
+          \ingroup blas3
+  */
+    template<class M, class T1, class L1, std::size_t IB1, class IA1, class TA1, class E2>
+    typename boost::enable_if_c<detail::spmm_dense_operands<M, E2>::value, M &>::type
+    axpy_prod (const compressed_matrix<T1, L1, IB1, IA1, TA1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, bool init = true) {
+        typedef typename M::value_type value_type;
+        typedef typename L1::orientation_category orientation_category;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == m.size1 () && e2 ().size2 () == m.size2 (), bad_size ());
+        if (init)
+            m.assign (zero_matrix<value_type> (e1.size1 (), e2 ().size2 ()));
+#if BOOST_UBLAS_TYPE_CHECK
+        matrix<value_type, row_major> cm (m);
+        typedef typename type_traits<value_type>::real_type real_type;
+        real_type merrorbound (norm_1 (m) + norm_1 (e1) * norm_1 (e2));
+        indexing_matrix_assign<scalar_plus_assign> (cm, prod (e1, e2), row_major_tag ());
+#endif
+        axpy_prod (e1, e2 (), m, orientation_category ());
+#if BOOST_UBLAS_TYPE_CHECK
+        BOOST_UBLAS_CHECK (norm_1 (m - cm) <= 2 * std::numeric_limits<real_type>::epsilon () * merrorbound, internal_logic ());
+#endif
+        return m;
+    }
+
+    namespace detail {
+
+        // Packed triangular storage keeps every major line of the stored triangle
+        // contiguous: line k holds the minor indices [first, last) starting at offset.
+        // For row lines k is the row index, for column lines the column index.
+        template<class L>
+        struct packed_lines {
+            template<class S>
+            static
+            BOOST_UBLAS_INLINE
+            void line (bool lower, S k, S size, S &first, S &last, S &offset, bool &row) {
+                row = boost::is_same<typename L::orientation_category, row_major_tag>::value;
+                // the line ends on the diagonal if the triangle lies on its leading side
+                const bool leading = row == lower;
+                first = leading ? 0 : k;
+                last = leading ? k + 1 : size;
+                const S i = row ? k : first, j = row ? first : k;
+                offset = lower ? L::lower_element (i, size, j, size) : L::upper_element (i, size, j, size);
+            }
+        };
+
+        // The RFP rectangle holds one part of the triangle by columns and the
+        // transposed part by rows, see basic_rfp_column_major.
+        template<class Z, class D>
+        struct packed_lines<basic_rfp_column_major<Z, D> > {
+            template<class S>
+            static
+            BOOST_UBLAS_INLINE
+            void line (bool lower, S k, S size, S &first, S &last, S &offset, bool &row) {
+                const S s = 1 - size % 2, ld = size + s;
+                if (lower) {
+                    const S n1 = (size + 1) / 2;
+                    row = k >= n1;
+                    first = row ? n1 : k;
+                    last = row ? k + 1 : size;
+                    offset = row ? (k - n1 + 1 - s) * ld : k * ld + k + s;
+                } else {
+                    const S n1 = size / 2;
+                    row = k < n1;
+                    first = row ? k : 0;
+                    last = row ? n1 : k + 1;
+                    offset = row ? k * ld + n1 + 1 + k : (k - n1) * ld;
+                }
+            }
+        };
+
+        template<class Z, class D>
+        struct packed_lines<basic_rfp_row_major<Z, D> > {
+            template<class S>
+            static
+            BOOST_UBLAS_INLINE
+            void line (bool lower, S k, S size, S &first, S &last, S &offset, bool &row) {
+                packed_lines<basic_rfp_column_major<Z, D> >::line (! lower, k, size, first, last, offset, row);
+                row = ! row;
+            }
+        };
+
+        template<class TRI, class L, class S>
+        BOOST_UBLAS_INLINE
+        void packed_line (S k, S size, S &first, S &last, S &offset, bool &row) {
+            packed_lines<L>::line (TRI::other (1, 0), k, size, first, last, offset, row);
+        }
+
+        // v += A x, A stored in the packed triangle data; F maps a stored element to its mirror
+        template<class F, class TRI, class L, class D, class E2, class V>
+        void packed_symv (const D &data, typename V::size_type size, const E2 &x, V &v) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+
+#pragma omp parallel if (double (size) * size > double (2 * kernel_parallel_work))
+            {
+                // contributions of the mirrored triangle, summed over the threads at the end
+                unbounded_array<value_type> mirror (size, value_type/*zero*/());
+#pragma omp for schedule (dynamic, 32)
+                for (size_type k = 0; k < size; ++ k) {
+                    size_type first, last, offset;
+                    bool row;
+                    packed_line<TRI, L> (k, size, first, last, offset, row);
+                    const value_type xk = x (k);
+                    value_type t = value_type/*zero*/();
+                    for (size_type m = first; m < last; ++ m) {
+                        const value_type a = data [offset + (m - first)];
+                        if (m == k) {
+                            t += a * xk;
+                        } else if (row) {
+                            // a = A (k, m)
+                            t += a * x (m);
+                            mirror [m] += F::apply (a) * xk;
+                        } else {
+                            // a = A (m, k)
+                            t += F::apply (a) * x (m);
+                            mirror [m] += a * xk;
+                        }
+                    }
+                    v (k) += t;
+                }
+#pragma omp critical
+                for (size_type k = 0; k < size; ++ k)
+                    v (k) += mirror [k];
+            }
+        }
+
+        // m += A b, every thread owning a block of columns of b and m
+        template<class F, class TRI, class L, class D, class E2, class M>
+        void packed_symm (const D &data, typename M::size_type size, const E2 &b, M &m) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size2 = m.size2 ();
+            const size_type blocks = (size2 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if (double (size) * size * size2 > double (2 * kernel_parallel_work))
+            for (size_type block = 0; block < blocks; ++ block) {
+                const size_type c0 = block * kernel_block_m, c1 = (std::min) (size2, size_type (c0 + kernel_block_m));
+                for (size_type k = 0; k < size; ++ k) {
+                    size_type first, last, offset;
+                    bool row;
+                    packed_line<TRI, L> (k, size, first, last, offset, row);
+                    for (size_type l = first; l < last; ++ l) {
+                        const value_type a = data [offset + (l - first)];
+                        // a = A (i, j), its mirror A (j, i)
+                        const size_type i = row ? k : l, j = row ? l : k;
+                        for (size_type c = c0; c < c1; ++ c)
+                            m (i, c) += a * b (j, c);
+                        if (l != k) {
+                            const value_type am = F::apply (a);
+                            for (size_type c = c0; c < c1; ++ c)
+                                m (j, c) += am * b (i, c);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Stored triangle of c = t1 * c + t2 * a * F (trans (a)), each element computed once
+        template<class F, class TRI, class L, class D, class T1, class T2, class E>
+        void packed_rank_k (D &data, typename E::size_type size, const T1 &t1, const T2 &t2, const E &a) {
+            typedef typename E::size_type size_type;
+            typedef typename D::value_type value_type;
+
+            const size_type size2 = a.size2 ();
+#pragma omp parallel for schedule (dynamic, 32) if (double (size) * size * size2 > double (2 * kernel_parallel_work))
+            for (size_type k = 0; k < size; ++ k) {
+                size_type first, last, offset;
+                bool row;
+                packed_line<TRI, L> (k, size, first, last, offset, row);
+                for (size_type l = first; l < last; ++ l) {
+                    const size_type i = row ? k : l, j = row ? l : k;
+                    value_type t = value_type/*zero*/();
+                    for (size_type p = 0; p < size2; ++ p)
+                        t += a (i, p) * F::apply (a (j, p));
+                    value_type &c = data [offset + (l - first)];
+                    c = t1 * c + t2 * t;
+                }
+            }
+        }
+
+        // Stored triangle of c = t1 * c + t2 * a * trans (a) in rectangular full packed
+        // storage, the diagonal blocks by SYRK and the full block by GEMM kernels
+        template<class T, class T1, class T2, class E>
+        void rfp_rank_k (const rfp_blocks<T> &r, const T1 &t1, const T2 &t2, const E &a) {
+            typedef typename rfp_blocks<T>::size_type size_type;
+            typedef typename rfp_blocks<T>::block_type block_type;
+
+            const size_type n1 = r.l11.size1 (), n2 = r.l22.size1 (), size2 = a.size2 ();
+            block_type l11 (r.l11), l21 (r.l21), l22 (r.l22);
+            // the strict upper parts of the diagonal blocks belong to the other triangle
+            for (size_type i = 0; i < n1; ++ i)
+                for (size_type j = 0; j <= i; ++ j)
+                    l11 (i, j) *= t1;
+            for (size_type i = 0; i < n2; ++ i) {
+                for (size_type j = 0; j < n1; ++ j)
+                    l21 (i, j) *= t1;
+                for (size_type j = 0; j <= i; ++ j)
+                    l22 (i, j) *= t1;
+            }
+            block_syrk (l11, t2, sub_block<const E>::apply (a, 0, n1, 0, size2));
+            block_gemm_nt (l21, t2, sub_block<const E>::apply (a, n1, n1 + n2, 0, size2),
+                           sub_block<const E>::apply (a, 0, n1, 0, size2));
+            block_syrk (l22, t2, sub_block<const E>::apply (a, n1, n1 + n2, 0, size2));
+        }
+
+    }
+
+    // Packed symmetric and hermitian products: the stored triangle is walked
+    // directly and every stored element serves both halves of the matrix.
+
+  /** \brief computes <tt>v += A x</tt> or <tt>v = A x</tt> for a packed symmetric matrix \c A (SYMV).
+
+          \ingroup blas2
+  */
+    template<class V, class T1, class TRI1, class L1, class A1, class E2>
+    V &
+    axpy_prod (const symmetric_matrix<T1, TRI1, L1, A1> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        detail::packed_symv<scalar_identity<T1>, TRI1, L1> (e1.data (), v.size (), e2 (), v);
+        return v;
+    }
+    template<class V, class T1, class TRI1, class L1, class A1, class E2>
+    V
+    axpy_prod (const symmetric_matrix<T1, TRI1, L1, A1> &e1,
+               const vector_expression<E2> &e2) {
+        typedef V vector_type;
+
+        vector_type v (e1.size1 ());
+        return axpy_prod (e1, e2, v, true);
+    }
+
+  /** \brief computes <tt>v += A x</tt> or <tt>v = A x</tt> for a packed hermitian matrix \c A (HEMV).
+
+          \ingroup blas2
+  */
+    template<class V, class T1, class TRI1, class L1, class A1, class E2>
+    V &
+    axpy_prod (const hermitian_matrix<T1, TRI1, L1, A1> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        detail::packed_symv<scalar_conj<T1>, TRI1, L1> (e1.data (), v.size (), e2 (), v);
+        return v;
+    }
+    template<class V, class T1, class TRI1, class L1, class A1, class E2>
+    V
+    axpy_prod (const hermitian_matrix<T1, TRI1, L1, A1> &e1,
+               const vector_expression<E2> &e2) {
+        typedef V vector_type;
+
+        vector_type v (e1.size1 ());
+        return axpy_prod (e1, e2, v, true);
+    }
+
+  /** \brief computes <tt>M += A X</tt> or <tt>M = A X</tt> for a packed symmetric matrix \c A (SYMM).
+
+          Blocks of 64 columns of \c X are processed in parallel.
+
+          \ingroup blas3
+  */
+    template<class M, class T1, class TRI1, class L1, class A1, class E2>
+    M &
+    axpy_prod (const symmetric_matrix<T1, TRI1, L1, A1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, bool init = true) {
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == m.size1 () && e2 ().size2 () == m.size2 (), bad_size ());
+        if (init)
+            m.assign (zero_matrix<value_type> (e1.size1 (), e2 ().size2 ()));
+        detail::packed_symm<scalar_identity<T1>, TRI1, L1> (e1.data (), m.size1 (), e2 (), m);
+        return m;
+    }
+
+  /** \brief computes <tt>M += A X</tt> or <tt>M = A X</tt> for a packed hermitian matrix \c A (HEMM).
+
+          Blocks of 64 columns of \c X are processed in parallel.
+
+          \ingroup blas3
+  */
+    template<class M, class T1, class TRI1, class L1, class A1, class E2>
+    M &
+    axpy_prod (const hermitian_matrix<T1, TRI1, L1, A1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, bool init = true) {
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == m.size1 () && e2 ().size2 () == m.size2 (), bad_size ());
+        if (init)
+            m.assign (zero_matrix<value_type> (e1.size1 (), e2 ().size2 ()));
+        detail::packed_symm<scalar_conj<T1>, TRI1, L1> (e1.data (), m.size1 (), e2 (), m);
+        return m;
+    }
+
+    namespace detail {
+
+        // Major lines of the band storage of banded_matrix: line k is a pointer
+        // indexed by the minor index, k * stride + offset being the position of
+        // the element with minor index 0
+        template<class T>
+        class band_storage_lines {
+        public:
+            typedef const T *line_type;
+
+            BOOST_UBLAS_INLINE
+            band_storage_lines (const T *data, std::size_t stride, std::size_t offset):
+                data_ (data), stride_ (stride), offset_ (offset) {}
+
+            BOOST_UBLAS_INLINE
+            const T *operator () (std::size_t k) const {
+                return data_ + k * stride_ + offset_;
+            }
+
+        private:
+            const T *data_;
+            std::size_t stride_, offset_;
+        };
+
+        // Rows or columns of a matrix read through its own accessors
+        template<class M, class O>
+        class band_matrix_lines {
+        public:
+            typedef typename boost::mpl::if_<boost::is_same<O, column_major_tag>,
+                                             matrix_column<const M>,
+                                             matrix_row<const M> >::type line_type;
+
+            BOOST_UBLAS_INLINE
+            band_matrix_lines (const M &m):
+                m_ (m) {}
+
+            BOOST_UBLAS_INLINE
+            line_type operator () (std::size_t k) const {
+                return line_type (m_, k);
+            }
+
+        private:
+            const M &m_;
+        };
+
+        // v += A x, lines (i) being the rows of the band of A.
+        // Every row is a dot product with a contiguous segment of x.
+        template<class LS, class E2, class V>
+        void band_mv (const LS &lines, std::size_t lower, std::size_t upper, const E2 &x, V &v, row_major_tag) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+
+            const size_type size1 = v.size (), size2 = x.size ();
+#pragma omp parallel for if (double (size1) * (lower + 1 + upper) > double (kernel_parallel_work))
+            for (size_type i = 0; i < size1; ++ i) {
+                const size_type first = i > lower ? i - lower : 0;
+                const size_type last = (std::min) (size2, size_type (i + 1 + upper));
+                const typename LS::line_type a (lines (i));
+                value_type t = value_type/*zero*/();
+                for (size_type j = first; j < last; ++ j)
+                    t += a [j] * x (j);
+                v (i) += t;
+            }
+        }
+        // v += A x, lines (j) being the columns of the band of A.
+        // Every column is an axpy into v; each thread owns a block of rows of v.
+        template<class LS, class E2, class V>
+        void band_mv (const LS &lines, std::size_t lower, std::size_t upper, const E2 &x, V &v, column_major_tag) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+
+            const size_type size1 = v.size (), size2 = x.size ();
+            const size_type blocks = (size1 + kernel_block_n - 1) / kernel_block_n;
+#pragma omp parallel for if (double (size1) * (lower + 1 + upper) > double (kernel_parallel_work))
+            for (size_type block = 0; block < blocks; ++ block) {
+                const size_type i0 = block * kernel_block_n, i1 = (std::min) (size1, size_type (i0 + kernel_block_n));
+                const size_type j0 = i0 > lower ? i0 - lower : 0;
+                const size_type j1 = (std::min) (size2, size_type (i1 + upper));
+                for (size_type j = j0; j < j1; ++ j) {
+                    const value_type t = x (j);
+                    if (t == value_type/*zero*/())
+                        continue;
+                    const size_type first = (std::max) (i0, size_type (j > upper ? j - upper : 0));
+                    const size_type last = (std::min) (i1, size_type (j + 1 + lower));
+                    const typename LS::line_type a (lines (j));
+                    for (size_type i = first; i < last; ++ i)
+                        v (i) += a [i] * t;
+                }
+            }
+        }
+
+    }
+
+    // Banded and diagonal products: only the band is visited, each row or
+    // column segment of it being contiguous in the storage of banded_matrix.
+
+  /** \brief computes <tt>v += A x</tt> or <tt>v = A x</tt> for a banded matrix \c A (GBMV).
+
+          A row major band is applied by rows as dot products, a column major
+          one by columns as axpys. Takes O(n * (lower () + upper () + 1)) operations.
+
+          \ingroup blas2
+  */
+    template<class V, class T1, class L1, class A1, class E2>
+    V &
+    axpy_prod (const banded_matrix<T1, L1, A1> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+        typedef typename L1::orientation_category orientation_category;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        if (e1.size1 () == 0 || e1.size2 () == 0)
+            return v;
+#if ! defined (BOOST_UBLAS_OWN_BANDED) && ! defined (BOOST_UBLAS_LEGACY_BANDED)
+        // netlib band storage: element (i, j) at i * (width - 1) + j + lower
+        // in a row major band, at i + j * (width - 1) + upper in a column major one
+        const std::size_t width = e1.lower () + 1 + e1.upper ();
+        const bool row = boost::is_same<orientation_category, row_major_tag>::value;
+        const detail::band_storage_lines<T1> lines (&e1.data () [0], width - 1, row ? e1.lower () : e1.upper ());
+#else
+        const detail::band_matrix_lines<banded_matrix<T1, L1, A1>, orientation_category> lines (e1);
+#endif
+        detail::band_mv (lines, e1.lower (), e1.upper (), e2 (), v, orientation_category ());
+        return v;
+    }
+    template<class V, class T1, class L1, class A1, class E2>
+    V
+    axpy_prod (const banded_matrix<T1, L1, A1> &e1,
+               const vector_expression<E2> &e2) {
+        typedef V vector_type;
+
+        vector_type v (e1.size1 ());
+        return axpy_prod (e1, e2, v, true);
+    }
+
+  /** \brief computes <tt>v += A x</tt> or <tt>v = A x</tt> for a banded adaptor \c A.
+
+          The adapted matrix is read inside the band only, in its own orientation.
+
+          \ingroup blas2
+  */
+    template<class V, class M1, class E2>
+    V &
+    axpy_prod (const banded_adaptor<M1> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::value_type value_type;
+        typedef typename boost::mpl::if_<boost::is_same<typename M1::orientation_category, column_major_tag>,
+                                         column_major_tag,
+                                         row_major_tag>::type orientation_category;
+        typedef typename banded_adaptor<M1>::matrix_closure_type matrix_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        const detail::band_matrix_lines<matrix_type, orientation_category> lines (e1.data ());
+        detail::band_mv (lines, e1.lower (), e1.upper (), e2 (), v, orientation_category ());
+        return v;
+    }
+    template<class V, class M1, class E2>
+    V
+    axpy_prod (const banded_adaptor<M1> &e1,
+               const vector_expression<E2> &e2) {
+        typedef V vector_type;
+
+        vector_type v (e1.size1 ());
+        return axpy_prod (e1, e2, v, true);
+    }
+
+  /** \brief computes <tt>v += D x</tt> or <tt>v = D x</tt> for a diagonal matrix \c D.
+
+          The product is an element wise scaling of \c x.
+
+          \ingroup blas2
+  */
+    template<class V, class T1, class L1, class A1, class E2>
+    V &
+    axpy_prod (const diagonal_matrix<T1, L1, A1> &e1,
+               const vector_expression<E2> &e2,
+               V &v, bool init = true) {
+        typedef typename V::size_type size_type;
+        typedef typename V::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == v.size (), bad_size ());
+        if (init)
+            v.assign (zero_vector<value_type> (e1.size1 ()));
+        // the diagonal is stored contiguously in every banded layout
+        const A1 &d = e1.data ();
+        const size_type size = (std::min) (e1.size1 (), e1.size2 ());
+#pragma omp parallel for if (size > size_type (detail::kernel_parallel_work))
+        for (size_type i = 0; i < size; ++ i)
+            v (i) += d [i] * e2 () (i);
+        return v;
+    }
+    template<class V, class T1, class L1, class A1, class E2>
+    V
+    axpy_prod (const diagonal_matrix<T1, L1, A1> &e1,
+               const vector_expression<E2> &e2) {
+        typedef V vector_type;
+
+        vector_type v (e1.size1 ());
+        return axpy_prod (e1, e2, v, true);
+    }
+
+  /** \brief computes <tt>M += D X</tt> or <tt>M = D X</tt> for a diagonal matrix \c D.
+
+          The rows of \c X are scaled by the diagonal.
+
+          \ingroup blas3
+  */
+    template<class M, class T1, class L1, class A1, class E2>
+    M &
+    axpy_prod (const diagonal_matrix<T1, L1, A1> &e1,
+               const matrix_expression<E2> &e2,
+               M &m, bool init = true) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (e1.size2 () == e2 ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (e1.size1 () == m.size1 () && e2 ().size2 () == m.size2 (), bad_size ());
+        if (init)
+            m.assign (zero_matrix<value_type> (e1.size1 (), e2 ().size2 ()));
+        const A1 &d = e1.data ();
+        const size_type size = (std::min) (e1.size1 (), e1.size2 ()), size2 = m.size2 ();
+#pragma omp parallel for if (double (size) * size2 > double (detail::kernel_parallel_work))
+        for (size_type i = 0; i < size; ++ i) {
+            const value_type t = d [i];
+            if (t == value_type/*zero*/())
+                continue;
+            for (size_type j = 0; j < size2; ++ j)
+                m (i, j) += t * e2 () (i, j);
+        }
+        return m;
+    }
+
 
     template<class M, class E1, class E2>
     BOOST_UBLAS_INLINE
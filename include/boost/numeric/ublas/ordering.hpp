@@ -0,0 +1,414 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_ORDERING_
+#define _BOOST_UBLAS_ORDERING_
+
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/lu.hpp>
+
+#include <algorithm>
+#include <vector>
+
+// Fill reducing and bandwidth reducing orderings of sparse matrix patterns.
+// An ordering is returned as a permutation_matrix p where p (i) is the
+// original index of the i-th row and column of the reordered matrix.
+// Note that this is the plain permutation vector, not the pivot sequence
+// produced by lu_factorize, so it must not be passed to swap_rows.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        /** \brief Adjacency structure of the symmetrised pattern of a square compressed matrix.
+         *
+         * The graph has an edge (i, j) whenever (i, j) or (j, i) is stored, the diagonal is ignored.
+         */
+        template<class S>
+        class ordering_graph {
+        public:
+            typedef S size_type;
+            typedef unbounded_array<size_type> index_array_type;
+
+            template<class M>
+            explicit
+            ordering_graph (const M &m):
+                size_ (m.size1 ()), ptr_ (size_ + 1, size_type (0)), adj_ () {
+                BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+                const size_type ib = M::index_base ();
+                const size_type size_M = m.filled1 () - 1;
+                for (size_type r = 0; r < size_M; ++ r) {
+                    for (size_type k = m.index1_data () [r] - ib; k < size_type (m.index1_data () [r + 1] - ib); ++ k) {
+                        const size_type c = m.index2_data () [k] - ib;
+                        if (c != r) {
+                            ++ ptr_ [r + 1];
+                            ++ ptr_ [c + 1];
+                        }
+                    }
+                }
+                for (size_type i = 0; i < size_; ++ i)
+                    ptr_ [i + 1] += ptr_ [i];
+                adj_.resize (ptr_ [size_]);
+                index_array_type next (size_);
+                std::copy (ptr_.begin (), ptr_.begin () + size_, next.begin ());
+                for (size_type r = 0; r < size_M; ++ r) {
+                    for (size_type k = m.index1_data () [r] - ib; k < size_type (m.index1_data () [r + 1] - ib); ++ k) {
+                        const size_type c = m.index2_data () [k] - ib;
+                        if (c != r) {
+                            adj_ [next [r] ++] = c;
+                            adj_ [next [c] ++] = r;
+                        }
+                    }
+                }
+                // Remove the duplicates of symmetric entries and compact
+                size_type filled = 0;
+                for (size_type i = 0; i < size_; ++ i) {
+                    typename index_array_type::iterator first (adj_.begin () + ptr_ [i]);
+                    typename index_array_type::iterator last (adj_.begin () + ptr_ [i + 1]);
+                    std::sort (first, last);
+                    last = std::unique (first, last);
+                    ptr_ [i] = filled;
+                    for (; first != last; ++ first)
+                        adj_ [filled ++] = *first;
+                }
+                ptr_ [size_] = filled;
+            }
+
+            BOOST_UBLAS_INLINE
+            size_type size () const {
+                return size_;
+            }
+            BOOST_UBLAS_INLINE
+            size_type degree (size_type v) const {
+                return ptr_ [v + 1] - ptr_ [v];
+            }
+            BOOST_UBLAS_INLINE
+            const size_type *begin (size_type v) const {
+                return adj_.begin () + ptr_ [v];
+            }
+            BOOST_UBLAS_INLINE
+            const size_type *end (size_type v) const {
+                return adj_.begin () + ptr_ [v + 1];
+            }
+
+        private:
+            size_type size_;
+            index_array_type ptr_;
+            index_array_type adj_;
+        };
+
+        /** \brief Breadth first level structures on the subgraphs of an ordering graph.
+         *
+         * Vertex v belongs to subgraph part () [v]. Visits are tracked by a stamp,
+         * so successive searches do not need to clear any state.
+         */
+        template<class S>
+        class level_structure {
+        public:
+            typedef S size_type;
+
+            explicit
+            level_structure (const ordering_graph<S> &g):
+                g_ (g), part_ (g.size (), size_type (0)), visit_ (g.size (), size_type (0)), stamp_ (0) {}
+
+            BOOST_UBLAS_INLINE
+            std::vector<size_type> &part () {
+                return part_;
+            }
+            // vertices of the last structure ordered by level, level l occupies [level_ptr () [l], level_ptr () [l + 1])
+            BOOST_UBLAS_INLINE
+            const std::vector<size_type> &order () const {
+                return order_;
+            }
+            BOOST_UBLAS_INLINE
+            const std::vector<size_type> &level_ptr () const {
+                return level_ptr_;
+            }
+            BOOST_UBLAS_INLINE
+            size_type levels () const {
+                return level_ptr_.size () - 1;
+            }
+
+            // Level structure rooted at root, restricted to the subgraph of root
+            void build (size_type root) {
+                const size_type id = part_ [root];
+                ++ stamp_;
+                order_.clear ();
+                level_ptr_.clear ();
+                order_.push_back (root);
+                visit_ [root] = stamp_;
+                size_type first = 0;
+                while (first < order_.size ()) {
+                    const size_type last = order_.size ();
+                    level_ptr_.push_back (first);
+                    for (size_type k = first; k < last; ++ k) {
+                        const size_type v = order_ [k];
+                        for (const size_type *w = g_.begin (v); w != g_.end (v); ++ w) {
+                            if (part_ [*w] == id && visit_ [*w] != stamp_) {
+                                visit_ [*w] = stamp_;
+                                order_.push_back (*w);
+                            }
+                        }
+                    }
+                    first = last;
+                }
+                level_ptr_.push_back (order_.size ());
+            }
+
+            // George and Liu: move the root to a vertex of minimum degree in the
+            // last level as long as this increases the number of levels
+            void build_pseudo_peripheral (size_type start) {
+                build (start);
+                for (;;) {
+                    const size_type n_levels = levels ();
+                    size_type candidate = order_ [level_ptr_ [n_levels - 1]];
+                    for (size_type k = level_ptr_ [n_levels - 1]; k < level_ptr_ [n_levels]; ++ k)
+                        if (g_.degree (order_ [k]) < g_.degree (candidate))
+                            candidate = order_ [k];
+                    const std::vector<size_type> order (order_), level_ptr (level_ptr_);
+                    build (candidate);
+                    if (levels () <= n_levels) {
+                        order_ = order;
+                        level_ptr_ = level_ptr;
+                        return;
+                    }
+                }
+            }
+
+        private:
+            const ordering_graph<S> &g_;
+            std::vector<size_type> part_;
+            std::vector<size_type> visit_;
+            size_type stamp_;
+            std::vector<size_type> order_;
+            std::vector<size_type> level_ptr_;
+        };
+
+        template<class S>
+        struct less_degree {
+            explicit
+            less_degree (const ordering_graph<S> &g): g_ (g) {}
+            bool operator () (S v, S w) const {
+                return g_.degree (v) < g_.degree (w) || (g_.degree (v) == g_.degree (w) && v < w);
+            }
+            const ordering_graph<S> &g_;
+        };
+
+        template<class S, class PM>
+        void dissect (level_structure<S> &ls, std::vector<S> &vertices, S hi, S leaf_size, S &next_id, PM &pm);
+
+        // Split one connected subgraph at the middle level of a pseudo peripheral
+        // level structure, the separator is numbered after both halves
+        template<class S, class PM>
+        void dissect_component (level_structure<S> &ls, std::vector<S> &vertices, S hi, S leaf_size, S &next_id, PM &pm) {
+            typedef S size_type;
+
+            const size_type n = vertices.size ();
+            if (n > leaf_size)
+                ls.build_pseudo_peripheral (vertices [0]);
+            if (n <= leaf_size || ls.levels () < 3) {
+                std::sort (vertices.begin (), vertices.end ());
+                for (size_type k = 0; k < n; ++ k)
+                    pm (hi - n + k) = vertices [k];
+                return;
+            }
+            const size_type mid = ls.levels () / 2;
+            const std::vector<size_type> &order = ls.order ();
+            std::vector<size_type> first (order.begin (), order.begin () + ls.level_ptr () [mid]);
+            std::vector<size_type> second (order.begin () + ls.level_ptr () [mid + 1], order.end ());
+            std::vector<size_type> separator (order.begin () + ls.level_ptr () [mid], order.begin () + ls.level_ptr () [mid + 1]);
+            std::sort (separator.begin (), separator.end ());
+            const size_type separator_id = next_id ++, first_id = next_id ++, second_id = next_id ++;
+            for (size_type k = 0; k < separator.size (); ++ k) {
+                ls.part () [separator [k]] = separator_id;
+                pm (hi - separator.size () + k) = separator [k];
+            }
+            for (size_type k = 0; k < first.size (); ++ k)
+                ls.part () [first [k]] = first_id;
+            for (size_type k = 0; k < second.size (); ++ k)
+                ls.part () [second [k]] = second_id;
+            vertices.clear ();
+            dissect (ls, second, size_type (hi - separator.size ()), leaf_size, next_id, pm);
+            dissect (ls, first, size_type (hi - separator.size () - second.size ()), leaf_size, next_id, pm);
+        }
+
+        // Number the vertices of one subgraph into positions [hi - vertices.size (), hi),
+        // one connected component after the other
+        template<class S, class PM>
+        void dissect (level_structure<S> &ls, std::vector<S> &vertices, S hi, S leaf_size, S &next_id, PM &pm) {
+            typedef S size_type;
+
+            const size_type id = vertices.empty () ? size_type (0) : ls.part () [vertices [0]];
+            for (size_type k = 0; k < vertices.size (); ++ k) {
+                const size_type v = vertices [k];
+                if (ls.part () [v] != id)
+                    continue;
+                ls.build (v);
+                std::vector<size_type> component (ls.order ());
+                const size_type component_id = next_id ++;
+                for (size_type c = 0; c < component.size (); ++ c)
+                    ls.part () [component [c]] = component_id;
+                const size_type component_size = component.size ();
+                dissect_component (ls, component, hi, leaf_size, next_id, pm);
+                hi -= component_size;
+            }
+        }
+
+    }
+
+    /** \brief Reverse Cuthill-McKee ordering of the symmetrised pattern of a square compressed matrix.
+     *
+     * Each connected component is traversed breadth first from a pseudo
+     * peripheral vertex, visiting neighbours by increasing degree. The
+     * reversed traversal reduces the bandwidth and profile of the matrix.
+     */
+    template<class M>
+    permutation_matrix<typename M::size_type>
+    reverse_cuthill_mckee (const M &m) {
+        typedef typename M::size_type size_type;
+
+        const detail::ordering_graph<size_type> g (m);
+        detail::level_structure<size_type> ls (g);
+        const size_type n = g.size ();
+        std::vector<size_type> order;
+        order.reserve (n);
+        std::vector<bool> numbered (n, false);
+        std::vector<size_type> neighbours;
+        for (size_type s = 0; s < n; ++ s) {
+            if (numbered [s])
+                continue;
+            ls.build_pseudo_peripheral (s);
+            size_type head = order.size ();
+            order.push_back (ls.order () [0]);
+            numbered [ls.order () [0]] = true;
+            for (; head < order.size (); ++ head) {
+                const size_type v = order [head];
+                neighbours.clear ();
+                for (const size_type *w = g.begin (v); w != g.end (v); ++ w) {
+                    if (! numbered [*w]) {
+                        numbered [*w] = true;
+                        neighbours.push_back (*w);
+                    }
+                }
+                std::sort (neighbours.begin (), neighbours.end (), detail::less_degree<size_type> (g));
+                order.insert (order.end (), neighbours.begin (), neighbours.end ());
+            }
+        }
+        permutation_matrix<size_type> pm (n);
+        for (size_type i = 0; i < n; ++ i)
+            pm (i) = order [n - 1 - i];
+        return pm;
+    }
+
+    /** \brief Nested dissection ordering of the symmetrised pattern of a square compressed matrix.
+     *
+     * Every connected subgraph is split by the middle level of a pseudo
+     * peripheral level structure. The separator is numbered last and both
+     * halves are ordered recursively, down to subgraphs of at most
+     * \c leaf_size vertices which keep their natural order.
+     */
+    template<class M>
+    permutation_matrix<typename M::size_type>
+    nested_dissection (const M &m, typename M::size_type leaf_size = 16) {
+        typedef typename M::size_type size_type;
+
+        const detail::ordering_graph<size_type> g (m);
+        detail::level_structure<size_type> ls (g);
+        const size_type n = g.size ();
+        permutation_matrix<size_type> pm (n);
+        std::vector<size_type> vertices (n);
+        for (size_type i = 0; i < n; ++ i)
+            vertices [i] = i;
+        size_type next_id = 1;
+        detail::dissect (ls, vertices, n, (std::max) (leaf_size, size_type (1)), next_id, pm);
+        return pm;
+    }
+
+    /** \brief Symmetric permutation <tt>b = P * a * P^T</tt>, i.e. <tt>b (i, j) = a (pm (i), pm (j))</tt>.
+     *
+     * The compressed arrays of \c b are built directly from those of \c a,
+     * each major line of \c b is copied from one line of \c a and sorted.
+     */
+    template<class M, class PM>
+    void
+    symmetric_permute (const M &a, const PM &pm, M &b) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a.size1 () == a.size2 (), bad_size ());
+        BOOST_UBLAS_CHECK (pm.size () == a.size1 (), bad_size ());
+        const size_type ib = M::index_base ();
+        const size_type n = a.size1 ();
+        const size_type filled_M = a.filled1 () - 1;
+        unbounded_array<size_type> inverse (n);
+        for (size_type i = 0; i < n; ++ i)
+            inverse [pm (i)] = i;
+
+        b.resize (n, n, false);
+        b.reserve (a.nnz (), false);
+        array_size_type filled = 0;
+        for (size_type i = 0; i < n; ++ i) {
+            b.index1_data () [i] = size_type (filled + ib);
+            const size_type r = pm (i);
+            if (r < filled_M)
+                filled += a.index1_data () [r + 1] - a.index1_data () [r];
+        }
+        b.index1_data () [n] = size_type (filled + ib);
+
+#pragma omp parallel
+        {
+            std::vector<std::pair<size_type, value_type> > line;
+#pragma omp for
+            for (size_type i = 0; i < n; ++ i) {
+                const size_type r = pm (i);
+                if (r >= filled_M)
+                    continue;
+                line.clear ();
+                for (array_size_type k = a.index1_data () [r] - ib; k < array_size_type (a.index1_data () [r + 1] - ib); ++ k)
+                    line.push_back (std::make_pair (inverse [a.index2_data () [k] - ib], a.value_data () [k]));
+                std::sort (line.begin (), line.end (), detail::less_pair<std::pair<size_type, value_type> > ());
+                array_size_type p = b.index1_data () [i] - ib;
+                for (size_type k = 0; k < line.size (); ++ k, ++ p) {
+                    b.index2_data () [p] = size_type (line [k].first + ib);
+                    b.value_data () [p] = line [k].second;
+                }
+            }
+        }
+        b.set_filled (n + 1, filled);
+    }
+
+    template<class M, class PM>
+    M
+    symmetric_permute (const M &a, const PM &pm) {
+        M b;
+        symmetric_permute (a, pm, b);
+        return b;
+    }
+
+    // Largest distance |i - j| of a stored element from the diagonal
+    template<class M>
+    typename M::size_type
+    bandwidth (const M &m) {
+        typedef typename M::size_type size_type;
+
+        const size_type ib = M::index_base ();
+        size_type result = 0;
+        for (size_type r = 0; r + 1 < m.filled1 (); ++ r) {
+            for (size_type k = m.index1_data () [r] - ib; k < size_type (m.index1_data () [r + 1] - ib); ++ k) {
+                const size_type c = m.index2_data () [k] - ib;
+                result = (std::max) (result, c < r ? r - c : c - r);
+            }
+        }
+        return result;
+    }
+
+}}}
+
+#endif
@@ -0,0 +1,299 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_QR_
+#define _BOOST_UBLAS_QR_
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_proxy.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+// Householder QR factorization of real matrices in the spirit of LAPACK's
+// GEQRF. A = Q R with Q = H (0) H (1) ... H (k - 1), k = min (m, n), and
+// H (i) = I - tau (i) v v', v (i) = 1 and v (0 .. i - 1) = 0. On return the
+// upper triangle of A holds R and the elements below the diagonal the
+// Householder vectors without their unit element.
+//
+// The columns are processed in panels. The reflectors of a panel are
+// accumulated into the compact WY form I - V T V' with T upper triangular,
+// so that they are applied to the trailing matrix by matrix products.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // sqrt (a * a + b * b) without destructive overflow or underflow
+        template<class T>
+        T scaled_hypot (const T &a, const T &b) {
+            using std::abs;
+            using std::sqrt;
+
+            const T x = abs (a), y = abs (b);
+            const T big = (std::max) (x, y), small = (std::min) (x, y);
+            if (big == T/*zero*/())
+                return T/*zero*/();
+            const T r = small / big;
+            return big * sqrt (T (1) + r * r);
+        }
+
+        // Unblocked factorization of the columns [j0, j1) of m, rows from j0 on
+        template<class M, class V>
+        void qr_factorize_panel (M &m, V &tau, typename M::size_type j0, typename M::size_type j1) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+            typedef matrix_range<M> range_type;
+            using std::abs;
+            using std::sqrt;
+
+            const size_type size1 = m.size1 ();
+            for (size_type k = j0; k < j1; ++ k) {
+                // norm of the part below the diagonal, scaled by its largest
+                // element so that the squares neither overflow nor underflow
+                value_type amax = value_type/*zero*/();
+#pragma omp parallel for reduction (max:amax) if (size1 - k > kernel_parallel_work / 64)
+                for (size_type i = k + 1; i < size1; ++ i)
+                    amax = (std::max) (amax, value_type (abs (m (i, k))));
+                const value_type alpha = m (k, k);
+                if (amax == value_type/*zero*/()) {
+                    // already triangular, H (k) = I
+                    tau (k) = value_type/*zero*/();
+                    continue;
+                }
+                value_type s = value_type/*zero*/();
+#pragma omp parallel for reduction (+:s) if (size1 - k > kernel_parallel_work / 64)
+                for (size_type i = k + 1; i < size1; ++ i) {
+                    const value_type x = m (i, k) / amax;
+                    s += x * x;
+                }
+                const value_type norm = scaled_hypot (alpha, amax * sqrt (s));
+                const value_type beta = alpha >= value_type/*zero*/() ? - norm : norm;
+                tau (k) = (beta - alpha) / beta;
+                const value_type scale = value_type (1) / (alpha - beta);
+#pragma omp parallel for if (size1 - k > kernel_parallel_work / 64)
+                for (size_type i = k + 1; i < size1; ++ i)
+                    m (i, k) *= scale;
+                m (k, k) = beta;
+                if (k + 1 == j1)
+                    continue;
+
+                // columns (k, j1) -= tau v (v' columns (k, j1)), v (k) = 1
+                matrix<value_type> w (1, j1 - k - 1);
+                for (size_type c = k + 1; c < j1; ++ c)
+                    w (0, c - k - 1) = m (k, c);
+                const range_type v (m, range (k + 1, size1), range (k, k + 1));
+                range_type below (m, range (k + 1, size1), range (k + 1, j1));
+                block_gemm_tn (w, value_type (1), v, below);
+                for (size_type c = k + 1; c < j1; ++ c)
+                    m (k, c) -= tau (k) * w (0, c - k - 1);
+                block_gemm (below, - tau (k), v, w);
+            }
+        }
+
+        // Compact WY form of the reflectors of the columns [j0, j1): v1 is the
+        // unit lower triangular top of V, t the upper triangular factor T
+        template<class M, class V, class W>
+        void qr_block_reflector (const M &m, const V &tau, typename M::size_type j0, typename M::size_type j1, W &v1, W &t) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size1 = m.size1 (), size = j1 - j0;
+            v1.resize (size, size, false);
+            t.resize (size, size, false);
+            for (size_type i = 0; i < size; ++ i)
+                for (size_type j = 0; j < size; ++ j)
+                    v1 (i, j) = i > j ? m (j0 + i, j0 + j) : value_type (i == j ? 1 : 0);
+            // Gram matrix g = V' V of the Householder vectors
+            W g (size, size);
+            g.clear ();
+            block_gemm_tn (g, value_type (1), v1, v1);
+            const matrix_range<const M> v2 (m, range (j1, size1), range (j0, j1));
+            block_gemm_tn (g, value_type (1), v2, v2);
+            // t (0 .. i, i) = - tau (i) t (0 .. i, 0 .. i) g (0 .. i, i)
+            t.clear ();
+            for (size_type i = 0; i < size; ++ i) {
+                const value_type ti = tau (j0 + i);
+                for (size_type r = 0; r < i; ++ r) {
+                    value_type s = value_type/*zero*/();
+                    for (size_type l = r; l < i; ++ l)
+                        s += t (r, l) * g (l, i);
+                    t (r, i) = - ti * s;
+                }
+                t (i, i) = ti;
+            }
+        }
+
+        // b = (I - V T V') b, or b = (I - V T' V') b if transpose, where b holds
+        // the rows [j0, size1) of the target and V the columns [j0, j1) of m
+        template<class M, class W, class B>
+        void qr_apply_block_reflector (const M &m, typename M::size_type j0, typename M::size_type j1,
+                                       const W &v1, const W &t, B &b, bool transpose) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+            typedef typename sub_block<B>::type block_type;
+
+            const size_type size1 = m.size1 (), size = j1 - j0, size2 = b.size2 ();
+            if (size2 == 0)
+                return;
+            block_type b1 (sub_block<B>::apply (b, 0, size, 0, size2));
+            block_type b2 (sub_block<B>::apply (b, size, b.size1 (), 0, size2));
+            const matrix_range<const M> v2 (m, range (j1, size1), range (j0, j1));
+            // w = V' b
+            W w (size, size2);
+            w.clear ();
+            block_gemm_tn (w, value_type (1), v1, b1);
+            block_gemm_tn (w, value_type (1), v2, b2);
+            // w = T w or T' w, T upper triangular
+            W tw (size, size2);
+            tw.clear ();
+            if (transpose)
+                block_gemm_tn (tw, value_type (1), t, w);
+            else
+                block_gemm (tw, value_type (1), t, w);
+            // b -= V w
+            block_gemm (b1, value_type (-1), v1, tw);
+            block_gemm (b2, value_type (-1), v2, tw);
+        }
+
+        // Q' b for the rows of b, the reflectors applied block by block
+        template<class M, class V, class B>
+        void qr_apply_qt (const M &m, const V &tau, B &b, typename M::size_type block_size) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size1 = m.size1 (), size = (std::min) (m.size1 (), m.size2 ());
+            matrix<value_type> v1, t;
+            for (size_type j0 = 0; j0 < size; j0 += block_size) {
+                const size_type j1 = (std::min) (size, size_type (j0 + block_size));
+                qr_block_reflector (m, tau, j0, j1, v1, t);
+                matrix_range<B> bj (b, range (j0, size1), range (0, b.size2 ()));
+                qr_apply_block_reflector (m, j0, j1, v1, t, bj, true);
+            }
+        }
+
+        // Q b for the rows of b, the reflectors applied block by block, last block first
+        template<class M, class V, class B>
+        void qr_apply_q (const M &m, const V &tau, B &b, typename M::size_type block_size) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            const size_type size1 = m.size1 (), size = (std::min) (m.size1 (), m.size2 ());
+            matrix<value_type> v1, t;
+            const size_type blocks = (size + block_size - 1) / block_size;
+            for (size_type block = blocks; block > 0; -- block) {
+                const size_type j0 = (block - 1) * block_size, j1 = (std::min) (size, size_type (j0 + block_size));
+                qr_block_reflector (m, tau, j0, j1, v1, t);
+                matrix_range<B> bj (b, range (j0, size1), range (0, b.size2 ()));
+                qr_apply_block_reflector (m, j0, j1, v1, t, bj, false);
+            }
+        }
+
+    }
+
+    /** \brief Blocked Householder QR factorization of a real matrix.
+     *
+     * Overwrites \c m with R and the Householder vectors, see above, and
+     * \c tau, of size min (m.size1 (), m.size2 ()), with their scalar factors.
+     * Panels of \c block_size columns are factorized column by column; their
+     * reflectors then update the trailing columns in compact WY form by
+     * matrix products, which run in parallel over the rows.
+     */
+    template<class M, class V>
+    void qr_factorize (M &m, V &tau, typename M::size_type block_size = 32) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+        const size_type size1 = m.size1 (), size2 = m.size2 (), size = (std::min) (size1, size2);
+        BOOST_UBLAS_CHECK (tau.size () == size, bad_size ());
+        matrix<value_type> v1, t;
+        for (size_type j0 = 0; j0 < size; j0 += block_size) {
+            const size_type j1 = (std::min) (size, size_type (j0 + block_size));
+            detail::qr_factorize_panel (m, tau, j0, j1);
+            if (j1 < size2) {
+                detail::qr_block_reflector (m, tau, j0, j1, v1, t);
+                matrix_range<M> trailing (m, range (j0, size1), range (j1, size2));
+                detail::qr_apply_block_reflector (m, j0, j1, v1, t, trailing, true);
+            }
+        }
+    }
+
+    /** \brief Least squares solution of A x = b from the QR factors of A.
+     *
+     * \c m and \c tau are the result of qr_factorize on A with
+     * m.size1 () >= m.size2 () and R nonsingular. On return the first
+     * m.size2 () elements of \c e hold x minimizing norm_2 (A x - b), the
+     * others the components of Q' b whose norm is the residual norm.
+     */
+    template<class M, class V, class E>
+    void qr_solve (const M &m, const V &tau, vector_expression<E> &e, typename M::size_type block_size = 32) {
+        typedef typename M::size_type size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size (), bad_size ());
+        BOOST_UBLAS_CHECK (m.size1 () >= m.size2 (), bad_size ());
+        const size_type size1 = m.size1 (), size2 = m.size2 ();
+        matrix<value_type, column_major> b (size1, 1);
+        column (b, 0) = e ();
+        detail::qr_apply_qt (m, tau, b, block_size);
+        vector_range<E> x (e (), range (0, size2));
+        x = project (column (b, 0), range (0, size2));
+        project (e (), range (size2, size1)) = project (column (b, 0), range (size2, size1));
+        inplace_solve (project (m, range (0, size2), range (0, size2)), x, upper_tag ());
+    }
+    /** \brief Least squares solutions for the columns of \c e, see qr_solve (m, tau, e). */
+    template<class M, class V, class E>
+    void qr_solve (const M &m, const V &tau, matrix_expression<E> &e, typename M::size_type block_size = 32) {
+        typedef typename M::size_type size_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == e ().size1 (), bad_size ());
+        BOOST_UBLAS_CHECK (m.size1 () >= m.size2 (), bad_size ());
+        const size_type size2 = m.size2 ();
+        detail::qr_apply_qt (m, tau, e (), block_size);
+        matrix_range<E> x (e (), range (0, size2), range (0, e ().size2 ()));
+        inplace_solve (project (m, range (0, size2), range (0, size2)), x, upper_tag ());
+    }
+
+    /** \brief Forms the leading columns of Q from the QR factors of A.
+     *
+     * \c q, of m.size1 () rows and between min (m.size1 (), m.size2 ()) and
+     * m.size1 () columns, receives the first q.size2 () columns of Q; with
+     * min (m.size1 (), m.size2 ()) columns this is the economy Q of the thin
+     * factorization A = Q R. The reflectors are applied block by block to the
+     * identity, last block first.
+     */
+    template<class M, class V, class MQ>
+    void qr_form_q (const M &m, const V &tau, MQ &q, typename M::size_type block_size = 32) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+
+        const size_type size1 = m.size1 (), size = (std::min) (m.size1 (), m.size2 ()), size2 = q.size2 ();
+        BOOST_UBLAS_CHECK (q.size1 () == size1, bad_size ());
+        BOOST_UBLAS_CHECK (size <= size2 && size2 <= size1, bad_size ());
+        BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+        q.assign (identity_matrix<value_type> (size1, size2));
+        matrix<value_type> v1, t;
+        const size_type blocks = (size + block_size - 1) / block_size;
+        for (size_type block = blocks; block > 0; -- block) {
+            const size_type j0 = (block - 1) * block_size, j1 = (std::min) (size, size_type (j0 + block_size));
+            detail::qr_block_reflector (m, tau, j0, j1, v1, t);
+            // the columns before j0 are still those of the identity below row j0
+            matrix_range<MQ> qj (q, range (j0, size1), range (j0, size2));
+            detail::qr_apply_block_reflector (m, j0, j1, v1, t, qj, false);
+        }
+    }
+
+}}}
+
+#endif
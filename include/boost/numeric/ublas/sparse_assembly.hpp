@@ -0,0 +1,272 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_SPARSE_ASSEMBLY_
+#define _BOOST_UBLAS_SPARSE_ASSEMBLY_
+
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+
+#include <algorithm>
+
+// Finite element style assembly into a compressed_matrix whose sparsity
+// pattern is frozen. The pattern is analysed once; afterwards the values
+// are refilled without any index search or reallocation.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // Position of element (i, j) inside the value array of a compressed matrix.
+        // Raises bad_index if the element is not part of the sparsity pattern.
+        template<class T, class L, std::size_t IB, class IA, class TA>
+        typename IA::size_type
+        compressed_slot (const compressed_matrix<T, L, IB, IA, TA> &m,
+                         typename IA::value_type i, typename IA::value_type j) {
+            typedef typename IA::value_type size_type;
+            typedef typename IA::const_iterator const_subiterator_type;
+
+            size_type element1 (L::index_M (i, j));
+            size_type element2 (L::index_m (i, j));
+            if (m.filled1 () <= element1 + 1)
+                bad_index ().raise ();
+            const_subiterator_type it_begin (m.index2_data ().begin () + (m.index1_data () [element1] - IB));
+            const_subiterator_type it_end (m.index2_data ().begin () + (m.index1_data () [element1 + 1] - IB));
+            const_subiterator_type it (detail::lower_bound (it_begin, it_end, element2 + IB, std::less<size_type> ()));
+            if (it == it_end || *it != element2 + IB)
+                bad_index ().raise ();
+            return it - m.index2_data ().begin ();
+        }
+
+    }
+
+    /** \brief Build the sparsity pattern of an assembled finite element matrix.
+     *
+     * Every element \c e couples the \c element_size global degrees of freedom
+     * <tt>dofs [e * element_size + a]</tt>, <tt>a = 0 .. element_size - 1</tt>.
+     * The matrix is resized to \c size1 x \c size2 and its index arrays are
+     * filled with the union of all element blocks. All values are set to zero.
+     */
+    template<class T, class L, std::size_t IB, class IA, class TA, class D>
+    void
+    compressed_pattern (compressed_matrix<T, L, IB, IA, TA> &m,
+                        typename IA::value_type size1, typename IA::value_type size2,
+                        typename IA::value_type n_elements, typename IA::value_type element_size,
+                        const D &dofs) {
+        typedef typename IA::value_type size_type;
+        typedef typename IA::size_type array_size_type;
+        typedef unbounded_array<size_type> index_buffer_type;
+
+        const size_type size_M = L::size_M (size1, size2);
+        const array_size_type n_local = array_size_type (element_size) * element_size;
+
+        // Bucket every coupling by its major index
+        unbounded_array<array_size_type> ptr (size_M + 1, array_size_type (0));
+        for (size_type e = 0; e < n_elements; ++ e) {
+            for (size_type a = 0; a < element_size; ++ a) {
+                for (size_type b = 0; b < element_size; ++ b) {
+                    const size_type i = dofs [e * element_size + a];
+                    const size_type j = dofs [e * element_size + b];
+                    BOOST_UBLAS_CHECK (i < size1 && j < size2, bad_index ());
+                    ++ ptr [L::index_M (i, j) + 1];
+                }
+            }
+        }
+        for (size_type k = 0; k < size_M; ++ k)
+            ptr [k + 1] += ptr [k];
+        index_buffer_type minor_data (n_elements * n_local);
+        unbounded_array<array_size_type> next (size_M);
+        std::copy (ptr.begin (), ptr.begin () + size_M, next.begin ());
+        for (size_type e = 0; e < n_elements; ++ e) {
+            for (size_type a = 0; a < element_size; ++ a) {
+                for (size_type b = 0; b < element_size; ++ b) {
+                    const size_type i = dofs [e * element_size + a];
+                    const size_type j = dofs [e * element_size + b];
+                    minor_data [next [L::index_M (i, j)] ++] = L::index_m (i, j);
+                }
+            }
+        }
+
+        // Sort and remove duplicates inside each major bucket
+        unbounded_array<array_size_type> counts (size_M);
+#pragma omp parallel for
+        for (size_type k = 0; k < size_M; ++ k) {
+            typename index_buffer_type::iterator first (minor_data.begin () + ptr [k]);
+            typename index_buffer_type::iterator last (minor_data.begin () + ptr [k + 1]);
+            std::sort (first, last);
+            counts [k] = std::unique (first, last) - first;
+        }
+
+        array_size_type non_zeros = 0;
+        for (size_type k = 0; k < size_M; ++ k)
+            non_zeros += counts [k];
+
+        m.resize (size1, size2, false);
+        m.reserve (non_zeros, false);
+        array_size_type filled = 0;
+        for (size_type k = 0; k < size_M; ++ k) {
+            m.index1_data () [k] = size_type (filled + IB);
+            for (array_size_type p = ptr [k]; p < ptr [k] + counts [k]; ++ p, ++ filled) {
+                m.index2_data () [filled] = minor_data [p] + IB;
+                m.value_data () [filled] = T/*zero*/();
+            }
+        }
+        m.index1_data () [size_M] = size_type (filled + IB);
+        m.set_filled (size_M + 1, filled);
+    }
+
+    /** \brief Precomputed scatter map from element entries to value slots of a compressed matrix.
+     *
+     * The map is built once for a fixed sparsity pattern. It stores, for every
+     * local entry <tt>(e, a, b)</tt>, the position of the global entry
+     * <tt>(dofs [e * n + a], dofs [e * n + b])</tt> in \c value_data(),
+     * together with the transposed (gather) map which lists all local entries
+     * contributing to each value slot. The gather map lets \c refill compute every
+     * slot independently, so it runs in parallel without atomics and gives
+     * results that do not depend on the number of threads.
+     *
+     * \tparam M the compressed_matrix type the map refers to
+     */
+    template<class M>
+    class compressed_scatter_map {
+    public:
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef unbounded_array<array_size_type> slot_array_type;
+
+        // Construction and destruction
+        template<class D>
+        compressed_scatter_map (const M &m, size_type n_elements, size_type element_size, const D &dofs):
+            n_elements_ (n_elements), element_size_ (element_size), value_size_ (m.nnz ()),
+            slot_data_ (array_size_type (n_elements) * element_size * element_size),
+            gather_ptr_ (value_size_ + 1, array_size_type (0)),
+            gather_data_ (slot_data_.size ()) {
+            const array_size_type n_local = array_size_type (element_size) * element_size;
+
+            // Analysis phase: one search per local entry, never repeated
+            for (size_type e = 0; e < n_elements; ++ e) {
+                for (size_type a = 0; a < element_size; ++ a) {
+                    for (size_type b = 0; b < element_size; ++ b) {
+                        slot_data_ [e * n_local + a * element_size + b] =
+                            detail::compressed_slot (m, dofs [e * element_size + a], dofs [e * element_size + b]);
+                    }
+                }
+            }
+
+            // Transpose into the gather map, keeping element order within each slot
+            for (array_size_type p = 0; p < slot_data_.size (); ++ p)
+                ++ gather_ptr_ [slot_data_ [p] + 1];
+            for (array_size_type k = 0; k < value_size_; ++ k)
+                gather_ptr_ [k + 1] += gather_ptr_ [k];
+            slot_array_type next (value_size_);
+            std::copy (gather_ptr_.begin (), gather_ptr_.begin () + value_size_, next.begin ());
+            for (array_size_type p = 0; p < slot_data_.size (); ++ p)
+                gather_data_ [next [slot_data_ [p]] ++] = p;
+        }
+
+        // Accessors
+        BOOST_UBLAS_INLINE
+        size_type element_count () const {
+            return n_elements_;
+        }
+        BOOST_UBLAS_INLINE
+        size_type element_size () const {
+            return element_size_;
+        }
+        BOOST_UBLAS_INLINE
+        array_size_type local_size () const {
+            return slot_data_.size ();
+        }
+        BOOST_UBLAS_INLINE
+        array_size_type value_size () const {
+            return value_size_;
+        }
+
+        // Slot of local entry (a, b) of element e
+        BOOST_UBLAS_INLINE
+        array_size_type slot (size_type e, size_type a, size_type b) const {
+            BOOST_UBLAS_CHECK (e < n_elements_, bad_index ());
+            BOOST_UBLAS_CHECK (a < element_size_ && b < element_size_, bad_index ());
+            return slot_data_ [(array_size_type (e) * element_size_ + a) * element_size_ + b];
+        }
+
+        // Storage accessors
+        BOOST_UBLAS_INLINE
+        const slot_array_type &slot_data () const {
+            return slot_data_;
+        }
+        BOOST_UBLAS_INLINE
+        const slot_array_type &gather_ptr () const {
+            return gather_ptr_;
+        }
+        BOOST_UBLAS_INLINE
+        const slot_array_type &gather_data () const {
+            return gather_data_;
+        }
+
+    private:
+        size_type n_elements_;
+        size_type element_size_;
+        array_size_type value_size_;
+        slot_array_type slot_data_;
+        slot_array_type gather_ptr_;
+        slot_array_type gather_data_;
+    };
+
+    /** \brief Zero the values of \c m and re-accumulate all element contributions.
+     *
+     * \c element_values holds the dense element matrices back to back, entry
+     * <tt>(e, a, b)</tt> at position <tt>(e * n + a) * n + b</tt>.
+     * The index arrays of \c m are left untouched.
+     */
+    template<class M, class V>
+    void
+    refill (M &m, const compressed_scatter_map<M> &map, const V &element_values) {
+        typedef typename M::value_type value_type;
+        typedef typename compressed_scatter_map<M>::array_size_type array_size_type;
+
+        BOOST_UBLAS_CHECK (map.value_size () == m.nnz (), bad_size ());
+        const array_size_type *ptr = &map.gather_ptr () [0];
+        const array_size_type *data = map.gather_data ().size () ? &map.gather_data () [0] : 0;
+        typename M::value_array_type &values = m.value_data ();
+#pragma omp parallel for
+        for (array_size_type k = 0; k < map.value_size (); ++ k) {
+            value_type t = value_type/*zero*/();
+            for (array_size_type p = ptr [k]; p < ptr [k + 1]; ++ p)
+                t += element_values [data [p]];
+            values [k] = t;
+        }
+    }
+
+    // Add the local matrix of one element, no search involved
+    template<class M, class E>
+    void
+    scatter_add (M &m, const compressed_scatter_map<M> &map,
+                 typename M::size_type e, const matrix_expression<E> &ae) {
+        typedef typename M::size_type size_type;
+
+        BOOST_UBLAS_CHECK (ae ().size1 () == map.element_size (), bad_size ());
+        BOOST_UBLAS_CHECK (ae ().size2 () == map.element_size (), bad_size ());
+        typename M::value_array_type &values = m.value_data ();
+        for (size_type a = 0; a < map.element_size (); ++ a)
+            for (size_type b = 0; b < map.element_size (); ++ b)
+                values [map.slot (e, a, b)] += ae () (a, b);
+    }
+
+    // Set all stored values to zero, keeping the pattern
+    template<class M>
+    void
+    zero_values (M &m) {
+        typedef typename M::value_type value_type;
+        typename M::value_array_type &values = m.value_data ();
+        std::fill (values.begin (), values.begin () + m.nnz (), value_type/*zero*/());
+    }
+
+}}}
+
+#endif
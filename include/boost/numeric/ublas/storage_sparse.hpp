@@ -14,6 +14,8 @@
 #define _BOOST_UBLAS_STORAGE_SPARSE_
 
 #include <map>
+#include <vector>
+#include <algorithm>
 #include <boost/serialization/collection_size_type.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/array.hpp>
@@ -55,6 +57,16 @@ namespace boost { namespace numeric { namespace ublas {
                 return p1.first < p2.first;
             }
         };
+        template<class I, class C>
+        BOOST_UBLAS_INLINE
+        bool is_sorted (I begin, I end, C compare) {
+            if (begin == end)
+                return true;
+            for (I next = begin; ++ next != end; begin = next)
+                if (compare (*next, *begin))
+                    return false;
+            return true;
+        }
         template<class T>
         struct less_triple {
             BOOST_UBLAS_INLINE
@@ -527,6 +539,338 @@ namespace boost { namespace numeric { namespace ublas {
     };
 
 
+    // Hash map array
+    //  Open addressing hash table with linear probing over a contiguous array
+    //  of (key, value) pairs. Elements are appended in insertion order, so
+    //  random insertion and find are O(1). The array is sorted lazily by the
+    //  first ordered access (begin, lower_bound, ...) or an explicit sort (),
+    //  after which it behaves like map_array.
+    //  As the const ordered accessors may sort, concurrent const access is only
+    //  safe once the elements are sorted: call sort () after the last insertion
+    //  before sharing the container (or a matrix or vector using it) between threads.
+    //  Implementation requires pair<I, T> allocator definition (without const)
+    template<class I, class T, class ALLOC>
+    class hash_map_array {
+    public:
+        typedef ALLOC allocator_type;
+        typedef typename boost::allocator_size_type<ALLOC>::type size_type;
+        typedef typename boost::allocator_difference_type<ALLOC>::type difference_type;
+        typedef std::pair<I,T> value_type;
+        typedef I key_type;
+        typedef T mapped_type;
+        typedef const value_type &const_reference;
+        typedef value_type &reference;
+        typedef const value_type *const_pointer;
+        typedef value_type *pointer;
+        // Iterators simply are pointers.
+        typedef const_pointer const_iterator;
+        typedef pointer iterator;
+
+        typedef const T &data_const_reference;
+#ifndef BOOST_UBLAS_STRICT_MAP_ARRAY
+        typedef T &data_reference;
+#else
+        typedef sparse_storage_element<hash_map_array> data_reference;
+#endif
+
+    private:
+        typedef std::vector<value_type, ALLOC> data_array_type;
+        // Positions are stored 1-based, 0 marks an empty slot
+        typedef std::vector<size_type> table_array_type;
+
+    public:
+        // Construction and destruction
+        BOOST_UBLAS_INLINE
+        hash_map_array (const ALLOC &a = ALLOC()):
+            data_ (a), table_ (), shift_ (0), sorted_ (true) {
+            rehash (min_table_size);
+        }
+
+        // Reserving
+        BOOST_UBLAS_INLINE
+        void reserve (size_type capacity) {
+            BOOST_UBLAS_CHECK (capacity >= size (), bad_size ());
+            data_.reserve (capacity);
+            if (2 * capacity > table_.size ())
+                rehash (2 * capacity);
+        }
+
+        // Random Access Container
+        BOOST_UBLAS_INLINE
+        size_type size () const {
+            return data_.size ();
+        }
+        BOOST_UBLAS_INLINE
+        size_type capacity () const {
+            return data_.capacity ();
+        }
+        BOOST_UBLAS_INLINE
+        size_type max_size () const {
+            return data_.max_size ();
+        }
+
+        BOOST_UBLAS_INLINE
+        bool empty () const {
+            return data_.empty ();
+        }
+
+        // Element access
+        BOOST_UBLAS_INLINE
+        data_reference operator [] (key_type i) {
+#ifndef BOOST_UBLAS_STRICT_MAP_ARRAY
+            return insert (value_type (i, mapped_type (0))).first->second;
+#else
+            return data_reference (*this, i);
+#endif
+        }
+
+        // Assignment
+        BOOST_UBLAS_INLINE
+        hash_map_array &assign_temporary (hash_map_array &a) {
+            swap (a);
+            return *this;
+        }
+
+        // Swapping
+        BOOST_UBLAS_INLINE
+        void swap (hash_map_array &a) {
+            if (this != &a) {
+                data_.swap (a.data_);
+                table_.swap (a.table_);
+                std::swap (shift_, a.shift_);
+                std::swap (sorted_, a.sorted_);
+            }
+        }
+        BOOST_UBLAS_INLINE
+        friend void swap (hash_map_array &a1, hash_map_array &a2) {
+            a1.swap (a2);
+        }
+
+        // Element insertion and deletion
+
+        // From Back Insertion Sequence concept
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        iterator push_back (iterator it, const value_type &p) {
+            // the last element only holds the largest key once sorted
+            sort ();
+            if (size () == 0 || data_.back ().first < p.first)
+                return append (p);
+            external_logic ().raise ();
+            return it;
+        }
+        // Form Unique Associative Container concept
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        std::pair<iterator,bool> insert (const value_type &p) {
+            iterator it = find (p.first);
+            if (it != end ())
+                return std::make_pair (it, false);
+            return std::make_pair (append (p), true);
+        }
+        // Form Sorted Associative Container concept
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        iterator insert (iterator /*hint*/, const value_type &p) {
+            return insert (p).first;
+        }
+        // Erasing keeps the order of the remaining elements and rebuilds the table
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void erase (iterator it) {
+            BOOST_UBLAS_CHECK (begin_pointer () <= it && it < end (), bad_index ());
+            data_.erase (data_.begin () + (it - begin_pointer ()));
+            fill_table ();
+        }
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void erase (iterator it1, iterator it2) {
+            if (it1 == it2) return /* nothing to erase */;
+            BOOST_UBLAS_CHECK (begin_pointer () <= it1 && it1 < it2 && it2 <= end (), bad_index ());
+            data_.erase (data_.begin () + (it1 - begin_pointer ()), data_.begin () + (it2 - begin_pointer ()));
+            fill_table ();
+        }
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void clear () {
+            data_.clear ();
+            std::fill (table_.begin (), table_.end (), size_type (0));
+            sorted_ = true;
+        }
+
+        // Element lookup - hashed, does not require the elements to be sorted
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        const_iterator find (key_type i) const {
+            const size_type mask = table_.size () - 1;
+            for (size_type h = hash (i); table_ [h] != 0; h = (h + 1) & mask) {
+                const_pointer p = begin_pointer () + (table_ [h] - 1);
+                if (p->first == i)
+                    return p;
+            }
+            return end ();
+        }
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        iterator find (key_type i) {
+            return const_cast<iterator> (const_cast<const hash_map_array &> (*this).find (i));
+        }
+        // Ordered lookup - sorts the elements first
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        const_iterator lower_bound (key_type i) const {
+            return detail::lower_bound (begin (), end (), value_type (i, mapped_type (0)), detail::less_pair<value_type> ());
+        }
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        iterator lower_bound (key_type i) {
+            return detail::lower_bound (begin (), end (), value_type (i, mapped_type (0)), detail::less_pair<value_type> ());
+        }
+
+        // Sort the elements by key once insertion is finished.
+        // Iterators obtained before are invalidated if the elements were not in order.
+        // Not thread-safe unless already sorted, then it does not modify the container.
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void sort () const {
+            if (sorted_)
+                return;
+            std::sort (data_.begin (), data_.end (), detail::less_pair<value_type> ());
+            fill_table ();
+            sorted_ = true;
+        }
+        BOOST_UBLAS_INLINE
+        bool sorted () const {
+            return sorted_;
+        }
+
+        BOOST_UBLAS_INLINE
+        const_iterator begin () const {
+            sort ();
+            return begin_pointer ();
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator cbegin () const {
+            return begin ();
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator end () const {
+            return begin_pointer () + size ();
+        }
+        BOOST_UBLAS_INLINE
+        const_iterator cend () const {
+            return end ();
+        }
+
+        BOOST_UBLAS_INLINE
+        iterator begin () {
+            sort ();
+            return begin_pointer ();
+        }
+        BOOST_UBLAS_INLINE
+        iterator end () {
+            return begin_pointer () + size ();
+        }
+
+        // Reverse iterators
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator rbegin () const {
+            sort ();
+            return const_reverse_iterator (end ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator crbegin () const {
+            return rbegin ();
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator rend () const {
+            return const_reverse_iterator (begin ());
+        }
+        BOOST_UBLAS_INLINE
+        const_reverse_iterator crend () const {
+            return rend ();
+        }
+
+        BOOST_UBLAS_INLINE
+        reverse_iterator rbegin () {
+            sort ();
+            return reverse_iterator (end ());
+        }
+        BOOST_UBLAS_INLINE
+        reverse_iterator rend () {
+            return reverse_iterator (begin ());
+        }
+
+        // Allocator
+        allocator_type get_allocator () {
+            return data_.get_allocator ();
+        }
+
+         // Serialization
+        template<class Archive>
+        void serialize(Archive & ar, const unsigned int /* file_version */){
+            serialization::collection_size_type s (size ());
+            ar & serialization::make_nvp("size",s);
+            if (Archive::is_loading::value) {
+                data_.resize (s);
+            }
+            if (s)
+                ar & serialization::make_array(&data_ [0], s);
+            if (Archive::is_loading::value) {
+                rehash (2 * s);
+                sorted_ = detail::is_sorted (data_.begin (), data_.end (), detail::less_pair<value_type> ());
+            }
+        }
+
+    private:
+        static const size_type min_table_size = 16;
+
+        BOOST_UBLAS_INLINE
+        pointer begin_pointer () const {
+            return data_.empty () ? pointer () : const_cast<pointer> (&data_ [0]);
+        }
+
+        // Fibonacci hashing: the high bits of key * 2^w / phi index the table
+        BOOST_UBLAS_INLINE
+        size_type hash (key_type i) const {
+            const std::size_t golden = sizeof (std::size_t) > 4 ? std::size_t (0x9E3779B97F4A7C15ull) : std::size_t (0x9E3779B9ul);
+            return size_type ((std::size_t (i) * golden) >> shift_);
+        }
+
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        iterator append (const value_type &p) {
+            if (2 * (size () + 1) > table_.size ())
+                rehash (2 * table_.size ());
+            sorted_ = sorted_ && (size () == 0 || data_.back ().first < p.first);
+            data_.push_back (p);
+            place (key_type (p.first), size ());
+            return end () - 1;
+        }
+        BOOST_UBLAS_INLINE
+        void place (key_type i, size_type position) const {
+            const size_type mask = table_.size () - 1;
+            size_type h = hash (i);
+            while (table_ [h] != 0)
+                h = (h + 1) & mask;
+            table_ [h] = position;
+        }
+        // Resize the table to the next power of two holding at least n slots
+        void rehash (size_type n) const {
+            size_type table_size = min_table_size;
+            shift_ = sizeof (std::size_t) * 8 - 4;
+            while (table_size < n) {
+                table_size <<= 1;
+                -- shift_;
+            }
+            table_.assign (table_size, size_type (0));
+            fill_table ();
+        }
+        void fill_table () const {
+            std::fill (table_.begin (), table_.end (), size_type (0));
+            for (size_type k = 0; k < size (); ++ k)
+                place (data_ [k].first, k + 1);
+        }
+
+        // Sorting on ordered access does not change the logical content
+        mutable data_array_type data_;
+        mutable table_array_type table_;
+        mutable std::size_t shift_;
+        mutable bool sorted_;
+    };
+
+
     namespace detail {
         template<class A, class T>
         struct map_traits {
@@ -536,6 +880,10 @@ namespace boost { namespace numeric { namespace ublas {
         struct map_traits<map_array<I, T, ALLOC>, T > {
             typedef typename map_array<I, T, ALLOC>::data_reference reference;
         };
+        template<class I, class T, class ALLOC>
+        struct map_traits<hash_map_array<I, T, ALLOC>, T > {
+            typedef typename hash_map_array<I, T, ALLOC>::data_reference reference;
+        };
 
         // reserve helpers for map_array and generic maps
         // ISSUE should be in map_traits but want to use on all compilers
@@ -549,6 +897,11 @@ namespace boost { namespace numeric { namespace ublas {
         void map_reserve (map_array<I, T, ALLOC> &m, typename map_array<I, T, ALLOC>::size_type capacity) {
             m.reserve (capacity);
         }
+        template<class I, class T, class ALLOC>
+        BOOST_UBLAS_INLINE
+        void map_reserve (hash_map_array<I, T, ALLOC> &m, typename hash_map_array<I, T, ALLOC>::size_type capacity) {
+            m.reserve ((std::max) (capacity, m.size ()));
+        }
 
         template<class M>
         struct map_capacity_traits {
@@ -566,6 +919,14 @@ namespace boost { namespace numeric { namespace ublas {
             }
         } ;
 
+        template<class I, class T, class ALLOC>
+        struct map_capacity_traits< hash_map_array<I, T, ALLOC> > {
+            typedef typename hash_map_array<I, T, ALLOC>::size_type type ;
+            type operator() ( hash_map_array<I, T, ALLOC> const& m ) const {
+               return m.capacity ();
+            }
+        } ;
+
         template<class M>
         BOOST_UBLAS_INLINE
         typename map_capacity_traits<M>::type map_capacity (M const& m) {
@@ -0,0 +1,851 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_SYMMETRIC_EIGEN_
+#define _BOOST_UBLAS_SYMMETRIC_EIGEN_
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_proxy.hpp>
+#include <boost/numeric/ublas/qr.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Eigenvalues and eigenvectors of real symmetric matrices in the spirit of
+// LAPACK's SYEVD and SYEVX. The matrix is reduced to a symmetric tridiagonal
+// matrix T = Q' A Q by Householder reflectors, T is diagonalized and the
+// eigenvectors of T are transformed back by Q.
+//
+// A tridiagonal matrix is given by its diagonal d and its off diagonal e,
+// e (i) = T (i + 1, i) = T (i, i + 1) for i < n - 1. All eigenvalues and
+// eigenvectors of T are computed by Cuppen's divide and conquer method, the
+// eigenvalues alone by the implicit QL iteration, and a few eigenpairs by
+// bisection and inverse iteration.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // Reduction of the columns [k, k + kb) of the symmetric matrix a, see
+        // symmetric_tridiagonalize, as LAPACK's LATRD. Row r of w, r >= k, ends up
+        // holding row r of the matrix W of the update a -= V W' + W V' of the
+        // trailing part by the Householder vectors V of the panel.
+        template<class M, class VE, class MW>
+        void tridiagonalize_panel (M &a, VE &e, VE &tau, typename M::size_type k, typename M::size_type kb, MW &w) {
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+            using std::sqrt;
+
+            const size_type size = a.size1 ();
+            w.resize (size - k, kb, false);
+            w.clear ();
+            for (size_type i = 0; i < kb; ++ i) {
+                const size_type c = k + i;
+                if (i > 0) {
+                    // Column c of the updates by the previous columns of the panel
+#pragma omp parallel for if ((size - c) * i > kernel_parallel_work / 64)
+                    for (size_type r = c; r < size; ++ r) {
+                        value_type s = value_type/*zero*/();
+                        for (size_type j = 0; j < i; ++ j)
+                            s += a (r, k + j) * w (c - k, j) + w (r - k, j) * a (c, k + j);
+                        a (r, c) -= s;
+                    }
+                }
+
+                // Householder reflector annihilating a (c + 2 .., c)
+                const value_type alpha = a (c + 1, c);
+                value_type s = value_type/*zero*/();
+#pragma omp parallel for reduction (+:s) if (size - c > kernel_parallel_work / 64)
+                for (size_type r = c + 2; r < size; ++ r)
+                    s += a (r, c) * a (r, c);
+                if (s == value_type/*zero*/()) {
+                    tau (c) = value_type/*zero*/();
+                    e (c) = alpha;
+                } else {
+                    const value_type norm = sqrt (alpha * alpha + s);
+                    const value_type beta = alpha >= value_type/*zero*/() ? - norm : norm;
+                    tau (c) = (beta - alpha) / beta;
+                    const value_type scale = value_type (1) / (alpha - beta);
+#pragma omp parallel for if (size - c > kernel_parallel_work / 64)
+                    for (size_type r = c + 2; r < size; ++ r)
+                        a (r, c) *= scale;
+                    e (c) = beta;
+                }
+                a (c + 1, c) = value_type (1);
+                if (tau (c) == value_type/*zero*/())
+                    continue;
+
+                // w = tau (A22 v - V W' v - W V' v), A22 the trailing part before the panel
+                const size_type blocks = (size - c - 1 + kernel_block_n - 1) / kernel_block_n;
+#pragma omp parallel for if (double (size - c) * (size - c) > double (kernel_parallel_work))
+                for (size_type block = 0; block < blocks; ++ block) {
+                    const size_type r0 = c + 1 + block * kernel_block_n, r1 = (std::min) (size, size_type (r0 + kernel_block_n));
+                    for (size_type j = c + 1; j < size; ++ j) {
+                        const value_type t = a (j, c);
+                        if (t == value_type/*zero*/())
+                            continue;
+                        for (size_type r = r0; r < r1; ++ r)
+                            w (r - k, i) += a (r, j) * t;
+                    }
+                }
+                if (i > 0) {
+                    vector<value_type> wv (i), vv (i);
+                    for (size_type j = 0; j < i; ++ j) {
+                        value_type sw = value_type/*zero*/(), sv = value_type/*zero*/();
+                        for (size_type r = c + 1; r < size; ++ r) {
+                            sw += w (r - k, j) * a (r, c);
+                            sv += a (r, k + j) * a (r, c);
+                        }
+                        wv (j) = sw;
+                        vv (j) = sv;
+                    }
+#pragma omp parallel for if ((size - c) * i > kernel_parallel_work / 64)
+                    for (size_type r = c + 1; r < size; ++ r) {
+                        value_type t = value_type/*zero*/();
+                        for (size_type j = 0; j < i; ++ j)
+                            t += a (r, k + j) * wv (j) + w (r - k, j) * vv (j);
+                        w (r - k, i) -= t;
+                    }
+                }
+                value_type wtv = value_type/*zero*/();
+                for (size_type r = c + 1; r < size; ++ r) {
+                    w (r - k, i) *= tau (c);
+                    wtv += w (r - k, i) * a (r, c);
+                }
+                const value_type gamma = - tau (c) * wtv / value_type (2);
+                for (size_type r = c + 1; r < size; ++ r)
+                    w (r - k, i) += gamma * a (r, c);
+            }
+        }
+
+        // Implicit QL iteration with Wilkinson shifts, as EISPACK's TQL2, on the
+        // tridiagonal matrix (d, e). With vectors the rotations are accumulated
+        // into the columns of z. The eigenvalues are sorted in increasing order.
+        template<class VD, class VE, class MZ>
+        typename VD::size_type tridiagonal_ql (VD &d, const VE &e, MZ &z, bool vectors) {
+            typedef typename VD::size_type size_type;
+            typedef typename VD::value_type value_type;
+            using std::abs;
+
+            const size_type size = d.size ();
+            if (size == 0)
+                return 0;
+            vector<value_type> f (size, value_type/*zero*/());
+            for (size_type i = 0; i + 1 < size; ++ i)
+                f (i) = e (i);
+            const value_type eps = std::numeric_limits<value_type>::epsilon ();
+            value_type shift = value_type/*zero*/(), tst1 = value_type/*zero*/();
+            for (size_type l = 0; l < size; ++ l) {
+                tst1 = (std::max) (tst1, abs (d (l)) + abs (f (l)));
+                size_type m = l;
+                while (m + 1 < size && abs (f (m)) > eps * tst1)
+                    ++ m;
+                if (m > l) {
+                    size_type iterations = 0;
+                    do {
+                        if (++ iterations > 30)
+                            return l + 1;
+                        value_type g = d (l);
+                        value_type p = (d (l + 1) - g) / (value_type (2) * f (l));
+                        value_type r = scaled_hypot (p, value_type (1));
+                        if (p < value_type/*zero*/())
+                            r = - r;
+                        d (l) = f (l) / (p + r);
+                        d (l + 1) = f (l) * (p + r);
+                        const value_type dl1 = d (l + 1);
+                        value_type h = g - d (l);
+                        for (size_type i = l + 2; i < size; ++ i)
+                            d (i) -= h;
+                        shift += h;
+
+                        p = d (m);
+                        value_type c = value_type (1), c2 = c, c3 = c;
+                        value_type s = value_type/*zero*/(), s2 = s;
+                        const value_type el1 = f (l + 1);
+                        for (size_type i = m; i -- > l; ) {
+                            c3 = c2;
+                            c2 = c;
+                            s2 = s;
+                            g = c * f (i);
+                            h = c * p;
+                            r = scaled_hypot (p, f (i));
+                            f (i + 1) = s * r;
+                            s = f (i) / r;
+                            c = p / r;
+                            p = c * d (i) - s * g;
+                            d (i + 1) = h + s * (c * g + s * d (i));
+                            if (vectors) {
+                                for (size_type k = 0; k < z.size1 (); ++ k) {
+                                    h = z (k, i + 1);
+                                    z (k, i + 1) = s * z (k, i) + c * h;
+                                    z (k, i) = c * z (k, i) - s * h;
+                                }
+                            }
+                        }
+                        p = - s * s2 * c3 * el1 * f (l) / dl1;
+                        f (l) = s * p;
+                        d (l) = c * p;
+                    } while (abs (f (l)) > eps * tst1);
+                }
+                d (l) += shift;
+                f (l) = value_type/*zero*/();
+            }
+
+            for (size_type i = 0; i + 1 < size; ++ i) {
+                size_type k = i;
+                for (size_type j = i + 1; j < size; ++ j)
+                    if (d (j) < d (k))
+                        k = j;
+                if (k != i) {
+                    std::swap (d (i), d (k));
+                    if (vectors)
+                        column (z, i).swap (column (z, k));
+                }
+            }
+            return 0;
+        }
+
+        // Orders indices by the values they refer to
+        template<class V>
+        struct eigen_index_less {
+            eigen_index_less (const V &v): v_ (v) {}
+            bool operator () (std::size_t i, std::size_t j) const {
+                return v_ (i) < v_ (j);
+            }
+            const V &v_;
+        };
+
+        // Root i of the secular equation 1 + rho sum_j z (j)^2 / (d (j) - x) = 0,
+        // d increasing, as origin and offset: x = d (origin) + tau. The root is
+        // bracketed between its poles and found by the rational approximation of
+        // Bunch, Nielsen and Sorensen from the two poles next to it, safeguarded by
+        // bisection. The offset from the nearest pole keeps x - d (j) accurate.
+        template<class V>
+        void secular_root (const V &d, const V &z, typename V::value_type rho, typename V::size_type i,
+                           typename V::size_type &origin, typename V::value_type &tau) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+            using std::abs;
+            using std::sqrt;
+
+            const size_type size = d.size ();
+            const value_type eps = std::numeric_limits<value_type>::epsilon ();
+            if (size == 1) {
+                origin = 0;
+                tau = rho * z (0) * z (0);
+                return;
+            }
+            value_type lo, hi;
+            if (i + 1 < size) {
+                // f increases from -inf to +inf between d (i) and d (i + 1)
+                const value_type gap = d (i + 1) - d (i), mid = gap / value_type (2);
+                value_type f = value_type (1);
+                for (size_type j = 0; j < size; ++ j)
+                    f += rho * z (j) * z (j) / ((d (j) - d (i)) - mid);
+                if (f >= value_type/*zero*/()) {
+                    origin = i;
+                    lo = value_type/*zero*/();
+                    hi = mid;
+                } else {
+                    origin = i + 1;
+                    lo = mid - gap;
+                    hi = value_type/*zero*/();
+                }
+            } else {
+                origin = i;
+                lo = value_type/*zero*/();
+                hi = value_type/*zero*/();
+                for (size_type j = 0; j < size; ++ j)
+                    hi += rho * z (j) * z (j);
+            }
+            vector<value_type> delta (size);
+            for (size_type j = 0; j < size; ++ j)
+                delta (j) = d (j) - d (origin);
+            // the poles of the approximation
+            const size_type p = i + 1 < size ? i : size - 2;
+
+            tau = (lo + hi) / value_type (2);
+            for (size_type iteration = 0; iteration < 200; ++ iteration) {
+                value_type psi = value_type/*zero*/(), dpsi = value_type/*zero*/();
+                value_type phi = value_type/*zero*/(), dphi = value_type/*zero*/();
+                value_type bound = value_type (1);
+                for (size_type j = 0; j < size; ++ j) {
+                    const value_type dj = delta (j) - tau;
+                    const value_type term = rho * z (j) * z (j) / dj;
+                    if (j <= p) {
+                        psi += term;
+                        dpsi += term / dj;
+                    } else {
+                        phi += term;
+                        dphi += term / dj;
+                    }
+                    bound += abs (term);
+                }
+                const value_type f = value_type (1) + psi + phi;
+                if (abs (f) <= value_type (8) * eps * bound)
+                    return;
+                if (f < value_type/*zero*/())
+                    lo = tau;
+                else
+                    hi = tau;
+                if (hi - lo <= value_type (2) * eps * (std::max) (abs (lo), abs (hi)))
+                    return;
+
+                // f (tau + eta) ~ c + s / (dp - eta) + t / (dq - eta)
+                const value_type dp = delta (p) - tau, dq = delta (p + 1) - tau;
+                const value_type s = dp * dp * dpsi, t = dq * dq * dphi;
+                const value_type c = f - dp * dpsi - dq * dphi;
+                // c eta^2 - b eta + f dp dq = 0
+                const value_type b = c * (dp + dq) + s + t, g = f * dp * dq;
+                value_type next = (lo + hi) / value_type (2);
+                value_type roots [2];
+                size_type count = 0;
+                if (c == value_type/*zero*/()) {
+                    if (b != value_type/*zero*/())
+                        roots [count ++] = g / b;
+                } else {
+                    const value_type discriminant = (std::max) (b * b - value_type (4) * c * g, value_type/*zero*/());
+                    const value_type q = (b >= value_type/*zero*/() ? b + sqrt (discriminant) : b - sqrt (discriminant)) / value_type (2);
+                    roots [count ++] = q / c;
+                    if (q != value_type/*zero*/())
+                        roots [count ++] = g / q;
+                }
+                for (size_type r = 0; r < count; ++ r)
+                    if (lo < tau + roots [r] && tau + roots [r] < hi) {
+                        next = tau + roots [r];
+                        break;
+                    }
+                tau = next;
+            }
+        }
+
+        // Merges the eigen decompositions of the blocks [o, o + n1) and [o + n1, o + n)
+        // held in d and the diagonal blocks of q into one of the block [o, o + n), the
+        // blocks being coupled by rho v v' with v = (q (o + n1 - 1, .) + sign q (o + n1, .)) / sqrt (2)
+        // in the basis of their eigenvectors, as LAPACK's LAED1.
+        template<class V, class Q>
+        void tridiagonal_merge (V &d, Q &q, typename V::size_type o, typename V::size_type size, typename V::size_type n1,
+                                typename V::value_type sign, typename V::value_type rho) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+            typedef matrix<value_type, column_major> matrix_type;
+            using std::abs;
+            using std::sqrt;
+
+            matrix_range<Q> qb (q, range (o, o + size), range (o, o + size));
+            vector<value_type> dv (project (d, range (o, o + size)));
+            vector<value_type> z (size);
+            const value_type scale = value_type (1) / sqrt (value_type (2));
+            for (size_type i = 0; i < size; ++ i)
+                z (i) = (qb (n1 - 1, i) + sign * qb (n1, i)) * scale;
+
+            // Deflation: negligible components of z and pairs of nearly equal poles
+            std::vector<size_type> order (size);
+            for (size_type i = 0; i < size; ++ i)
+                order [i] = i;
+            std::stable_sort (order.begin (), order.end (), eigen_index_less<vector<value_type> > (dv));
+            const value_type eps = std::numeric_limits<value_type>::epsilon ();
+            const value_type tol = value_type (8) * eps * (std::max) (norm_inf (dv), norm_inf (z));
+            std::vector<size_type> kept, deflated;
+            size_type pj = size;
+            for (size_type n = 0; n < size; ++ n) {
+                const size_type j = order [n];
+                if (rho * abs (z (j)) <= tol) {
+                    deflated.push_back (j);
+                    continue;
+                }
+                if (pj == size) {
+                    pj = j;
+                    continue;
+                }
+                const value_type t = scaled_hypot (z (j), z (pj));
+                const value_type c = z (j) / t, s = - z (pj) / t;
+                if (abs ((dv (j) - dv (pj)) * c * s) <= tol) {
+                    // rotate the pair so that z (pj) vanishes
+                    z (j) = t;
+                    z (pj) = value_type/*zero*/();
+                    for (size_type r = 0; r < size; ++ r) {
+                        const value_type x = qb (r, pj), y = qb (r, j);
+                        qb (r, pj) = c * x + s * y;
+                        qb (r, j) = c * y - s * x;
+                    }
+                    const value_type dpj = dv (pj) * c * c + dv (j) * s * s;
+                    dv (j) = dv (pj) * s * s + dv (j) * c * c;
+                    dv (pj) = dpj;
+                    deflated.push_back (pj);
+                } else {
+                    kept.push_back (pj);
+                }
+                pj = j;
+            }
+            if (pj != size)
+                kept.push_back (pj);
+            std::stable_sort (kept.begin (), kept.end (), eigen_index_less<vector<value_type> > (dv));
+
+            // Secular equation of the remaining k poles
+            const size_type k = kept.size ();
+            vector<value_type> dk (k), zk (k), tau (k);
+            std::vector<size_type> origin (k);
+            for (size_type j = 0; j < k; ++ j) {
+                dk (j) = dv (kept [j]);
+                zk (j) = z (kept [j]);
+            }
+#pragma omp parallel for if (k * k > kernel_parallel_work / 64)
+            for (size_type j = 0; j < k; ++ j)
+                secular_root (dk, zk, rho, j, origin [j], tau (j));
+
+            // Eigenvectors of D + rho z z' from the z of Gu and Eisenstat, which is
+            // consistent with the computed eigenvalues and keeps them orthogonal
+            matrix_type u (k, k);
+#pragma omp parallel for if (k * k > kernel_parallel_work / 64)
+            for (size_type r = 0; r < k; ++ r) {
+                value_type product = (tau (r) - (dk (r) - dk (origin [r]))) / rho;
+                for (size_type j = 0; j < k; ++ j)
+                    if (j != r)
+                        product *= (tau (j) - (dk (r) - dk (origin [j]))) / (dk (j) - dk (r));
+                const value_type zr = sqrt (abs (product));
+                const value_type zhat = zk (r) >= value_type/*zero*/() ? zr : - zr;
+                for (size_type j = 0; j < k; ++ j)
+                    u (r, j) = zhat / ((dk (r) - dk (origin [j])) - tau (j));
+            }
+            for (size_type j = 0; j < k; ++ j) {
+                const value_type norm = norm_2 (column (u, j));
+                column (u, j) /= norm;
+            }
+            matrix_type p (size, k);
+            p.clear ();
+            {
+                matrix_type qk (size, k);
+                for (size_type j = 0; j < k; ++ j)
+                    column (qk, j) = column (qb, kept [j]);
+                block_gemm (p, value_type (1), qk, u);
+            }
+            const size_type nd = deflated.size ();
+            matrix_type qd (size, nd);
+            for (size_type j = 0; j < nd; ++ j)
+                column (qd, j) = column (qb, deflated [j]);
+
+            // Both sets in increasing order of the eigenvalues
+            vector<value_type> lambda (size);
+            for (size_type j = 0; j < k; ++ j)
+                lambda (j) = dk (origin [j]) + tau (j);
+            for (size_type j = 0; j < nd; ++ j)
+                lambda (k + j) = dv (deflated [j]);
+            for (size_type i = 0; i < size; ++ i)
+                order [i] = i;
+            std::stable_sort (order.begin (), order.end (), eigen_index_less<vector<value_type> > (lambda));
+            for (size_type i = 0; i < size; ++ i) {
+                const size_type j = order [i];
+                d (o + i) = lambda (j);
+                if (j < k)
+                    column (qb, i) = column (p, j);
+                else
+                    column (qb, i) = column (qd, j - k);
+            }
+        }
+
+        // Divide and conquer on the block [o, o + n) of (d, e), whose eigenvectors
+        // are written into the diagonal block of q
+        template<class V, class Q>
+        typename V::size_type tridiagonal_divide (V &d, const V &e, Q &q, typename V::size_type o, typename V::size_type size) {
+            typedef typename V::size_type size_type;
+            typedef typename V::value_type value_type;
+            using std::abs;
+
+            if (size <= 25) {
+                vector_range<V> db (d, range (o, o + size));
+                const vector_range<const V> eb (e, range (o, o + size - 1));
+                matrix_range<Q> qb (q, range (o, o + size), range (o, o + size));
+                qb.assign (identity_matrix<value_type> (size));
+                const size_type info = tridiagonal_ql (db, eb, qb, true);
+                return info != 0 ? o + info : 0;
+            }
+            // T = diag (T1, T2) + |beta| v v' with v = e (n1 - 1) + sign (beta) e (n1)
+            const size_type n1 = size / 2;
+            const value_type beta = e (o + n1 - 1), rho = abs (beta);
+            d (o + n1 - 1) -= rho;
+            d (o + n1) -= rho;
+            size_type info = tridiagonal_divide (d, e, q, o, n1);
+            if (info == 0)
+                info = tridiagonal_divide (d, e, q, o + n1, size - n1);
+            if (info != 0)
+                return info;
+            tridiagonal_merge (d, q, o, size, n1, beta < value_type/*zero*/() ? value_type (-1) : value_type (1), value_type (2) * rho);
+            return 0;
+        }
+
+        // Number of eigenvalues of the tridiagonal matrix (d, e) less than x
+        template<class VD, class VE>
+        typename VD::size_type sturm_count (const VD &d, const VE &e, typename VD::value_type x, typename VD::value_type pivmin) {
+            typedef typename VD::size_type size_type;
+            typedef typename VD::value_type value_type;
+            using std::abs;
+
+            size_type count = 0;
+            value_type q = value_type (1);
+            for (size_type i = 0; i < d.size (); ++ i) {
+                q = d (i) - x - (i > 0 ? e (i - 1) * e (i - 1) / q : value_type/*zero*/());
+                if (abs (q) < pivmin)
+                    q = - pivmin;
+                if (q < value_type/*zero*/())
+                    ++ count;
+            }
+            return count;
+        }
+
+        // Eigenvalue index of the tridiagonal matrix (d, e), counted from the smallest,
+        // by bisection on the Sturm count within the Gershgorin bounds
+        template<class VD, class VE>
+        typename VD::value_type tridiagonal_bisect (const VD &d, const VE &e, typename VD::size_type index) {
+            typedef typename VD::size_type size_type;
+            typedef typename VD::value_type value_type;
+            using std::abs;
+
+            const size_type size = d.size ();
+            const value_type eps = std::numeric_limits<value_type>::epsilon ();
+            value_type lo = d (0), hi = d (0), emax = value_type/*zero*/();
+            for (size_type i = 0; i < size; ++ i) {
+                const value_type radius = (i > 0 ? abs (e (i - 1)) : value_type/*zero*/()) +
+                                          (i + 1 < size ? abs (e (i)) : value_type/*zero*/());
+                lo = (std::min) (lo, d (i) - radius);
+                hi = (std::max) (hi, d (i) + radius);
+                if (i + 1 < size)
+                    emax = (std::max) (emax, e (i) * e (i));
+            }
+            const value_type pivmin = (std::numeric_limits<value_type>::min) () * (std::max) (value_type (1), emax);
+            const value_type width = value_type (2) * eps * size * (std::max) (abs (lo), abs (hi)) + pivmin;
+            const value_type gershgorin_lo = lo, gershgorin_hi = hi;
+            lo -= width;
+            hi += width;
+            for (size_type iteration = 0; iteration < 200; ++ iteration) {
+                if (hi - lo <= value_type (2) * eps * (std::max) (abs (lo), abs (hi)) + pivmin)
+                    break;
+                const value_type mid = lo + (hi - lo) / value_type (2);
+                if (sturm_count (d, e, mid, pivmin) > index)
+                    hi = mid;
+                else
+                    lo = mid;
+            }
+            // the pivmin offsets of the Sturm count must not leak into the result,
+            // an exactly zero eigenvalue comes back as zero
+            const value_type lambda = (std::min) ((std::max) (lo + (hi - lo) / value_type (2), gershgorin_lo), gershgorin_hi);
+            return abs (lambda) <= pivmin ? value_type/*zero*/() : lambda;
+        }
+
+        // Solution of (T - lambda I) x = b by Gaussian elimination with partial
+        // pivoting, as LAPACK's GTTRF and GTTRS; tiny pivots are replaced by pivmin
+        template<class VD, class VE, class V>
+        void shifted_tridiagonal_solve (const VD &d, const VE &e, typename VD::value_type lambda,
+                                        typename VD::value_type pivmin, V &b) {
+            typedef typename VD::size_type size_type;
+            typedef typename VD::value_type value_type;
+            using std::abs;
+
+            const size_type size = d.size ();
+            vector<value_type> dl (size), dd (size), du (size), du2 (size, value_type/*zero*/());
+            std::vector<bool> swapped (size, false);
+            for (size_type i = 0; i < size; ++ i) {
+                dd (i) = d (i) - lambda;
+                if (i + 1 < size)
+                    dl (i) = du (i) = e (i);
+            }
+            for (size_type i = 0; i + 1 < size; ++ i) {
+                if (abs (dd (i)) >= abs (dl (i))) {
+                    if (abs (dd (i)) < pivmin)
+                        dd (i) = dd (i) < value_type/*zero*/() ? - pivmin : pivmin;
+                    const value_type factor = dl (i) / dd (i);
+                    dl (i) = factor;
+                    dd (i + 1) -= factor * du (i);
+                } else {
+                    const value_type factor = dd (i) / dl (i);
+                    dd (i) = dl (i);
+                    dl (i) = factor;
+                    const value_type temp = du (i);
+                    du (i) = dd (i + 1);
+                    dd (i + 1) = temp - factor * dd (i + 1);
+                    if (i + 2 < size) {
+                        du2 (i) = du (i + 1);
+                        du (i + 1) = - factor * du (i + 1);
+                    }
+                    swapped [i] = true;
+                }
+            }
+            if (abs (dd (size - 1)) < pivmin)
+                dd (size - 1) = dd (size - 1) < value_type/*zero*/() ? - pivmin : pivmin;
+
+            for (size_type i = 0; i + 1 < size; ++ i) {
+                if (swapped [i]) {
+                    const value_type temp = b (i);
+                    b (i) = b (i + 1);
+                    b (i + 1) = temp - dl (i) * b (i);
+                } else {
+                    b (i + 1) -= dl (i) * b (i);
+                }
+            }
+            for (size_type i = size; i -- > 0; ) {
+                value_type s = b (i);
+                if (i + 1 < size)
+                    s -= du (i) * b (i + 1);
+                if (i + 2 < size)
+                    s -= du2 (i) * b (i + 2);
+                b (i) = s / dd (i);
+            }
+        }
+
+        // Eigenvectors of the tridiagonal matrix (d, e) for the eigenvalues w by
+        // inverse iteration, as LAPACK's STEIN; the vectors of eigenvalues closer
+        // than 1e-3 norm (T) are orthogonalized against each other
+        template<class VD, class VE, class VW, class MZ>
+        void tridiagonal_inverse_iteration (const VD &d, const VE &e, const VW &w, MZ &z) {
+            typedef typename VD::size_type size_type;
+            typedef typename VD::value_type value_type;
+            using std::abs;
+
+            const size_type size = d.size (), count = w.size ();
+            const value_type eps = std::numeric_limits<value_type>::epsilon ();
+            value_type tnorm = value_type/*zero*/();
+            for (size_type i = 0; i < size; ++ i)
+                tnorm = (std::max) (tnorm, abs (d (i)) + (i > 0 ? abs (e (i - 1)) : value_type/*zero*/()) +
+                                           (i + 1 < size ? abs (e (i)) : value_type/*zero*/()));
+            const value_type pivmin = (std::max) (eps * tnorm, (std::numeric_limits<value_type>::min) ());
+            const value_type ortol = value_type (1.0e-3) * tnorm;
+
+            size_type first = 0;
+            value_type previous = value_type/*zero*/();
+            vector<value_type> x (size);
+            for (size_type j = 0; j < count; ++ j) {
+                value_type lambda = w (j);
+                if (j == 0 || abs (lambda - w (j - 1)) > ortol)
+                    first = j;
+                else if (abs (lambda - previous) < value_type (10) * eps * tnorm)
+                    // separate equal eigenvalues so that the iterations differ
+                    lambda = previous + (lambda <= previous ? value_type (-10) : value_type (10)) * eps * tnorm;
+                previous = lambda;
+
+                unsigned long seed = 2 * j + 1;
+                for (size_type i = 0; i < size; ++ i) {
+                    seed = seed * 1103515245ul + 12345ul;
+                    x (i) = value_type ((seed >> 16) & 0x7fff) / value_type (32768) - value_type (0.5);
+                }
+                for (size_type iteration = 0; iteration < 3; ++ iteration) {
+                    x /= norm_2 (x);
+                    shifted_tridiagonal_solve (d, e, lambda, pivmin, x);
+                    for (size_type l = first; l < j; ++ l)
+                        x -= inner_prod (column (z, l), x) * column (z, l);
+                }
+                column (z, j) = x / norm_2 (x);
+            }
+        }
+
+        // z = diag (1, Q22) z, Q22 given by the reflectors left by symmetric_tridiagonalize
+        template<class M, class V, class MZ>
+        void tridiagonal_back_transform (const M &a, const V &tau, MZ &z, typename M::size_type block_size) {
+            typedef typename M::size_type size_type;
+
+            const size_type size = a.size1 ();
+            if (size < 2)
+                return;
+            const matrix_range<const M> reflectors (a, range (1, size), range (0, size - 1));
+            matrix_range<MZ> rows (z, range (1, size), range (0, z.size2 ()));
+            qr_apply_q (reflectors, tau, rows, block_size);
+        }
+
+    }
+
+    /** \brief Householder reduction of a real symmetric matrix to tridiagonal form.
+     *
+     * \c a holds the full symmetric matrix, both triangles. On return T = Q' A Q
+     * is tridiagonal with diagonal \c d and off diagonal \c e, Q = H (0) ...
+     * H (n - 2) with H (i) = I - tau (i) v v' acting on the rows from i + 1 on,
+     * whose vectors v, without their unit element v (i + 1), are left below
+     * the subdiagonal of \c a. As in LAPACK's SYTRD, panels of \c block_size
+     * columns are reduced with the updates kept aside and then applied to the
+     * trailing matrix by two matrix products. A column major \c a is accessed
+     * contiguously.
+     */
+    template<class M, class VD, class VE>
+    void symmetric_tridiagonalize (M &a, VD &d, VE &e, VE &tau, typename M::size_type block_size = 32) {
+        typedef typename M::size_type size_type;
+        typedef typename M::value_type value_type;
+
+        BOOST_UBLAS_CHECK (block_size > 0, bad_argument ());
+        BOOST_UBLAS_CHECK (a.size1 () == a.size2 (), bad_size ());
+        const size_type size = a.size1 ();
+        BOOST_UBLAS_CHECK (d.size () == size, bad_size ());
+        BOOST_UBLAS_CHECK (e.size () == (size > 0 ? size - 1 : 0) && tau.size () == e.size (), bad_size ());
+        matrix<value_type, column_major> w;
+        for (size_type k = 0; k + 1 < size; k += block_size) {
+            const size_type kb = (std::min) (block_size, size - 1 - k), k1 = k + kb;
+            detail::tridiagonalize_panel (a, e, tau, k, kb, w);
+            if (k1 < size) {
+                matrix_range<M> a22 (a, range (k1, size), range (k1, size));
+                const matrix_range<M> v (a, range (k1, size), range (k, k1));
+                const matrix_range<matrix<value_type, column_major> > wr (w, range (kb, size - k), range (0, kb));
+                detail::block_gemm (a22, value_type (-1), v, trans (wr));
+                detail::block_gemm (a22, value_type (-1), wr, trans (v));
+            }
+            for (size_type c = k; c < k1; ++ c)
+                a (c + 1, c) = e (c);
+        }
+        for (size_type i = 0; i < size; ++ i)
+            d (i) = a (i, i);
+    }
+
+    /** \brief Eigenvalues of a real symmetric tridiagonal matrix by the implicit QL iteration.
+     *
+     * On return \c d holds the eigenvalues in increasing order; \c e is left
+     * unchanged.
+     *
+     * \return 0 on success, else one plus the index of an eigenvalue that did not converge.
+     */
+    template<class VD, class VE>
+    typename VD::size_type tridiagonal_eigen (VD &d, const VE &e) {
+        BOOST_UBLAS_CHECK (e.size () + 1 == d.size () || (d.size () == 0 && e.size () == 0), bad_size ());
+        matrix<typename VD::value_type> z;
+        return detail::tridiagonal_ql (d, e, z, false);
+    }
+
+    /** \brief Eigenvalues and eigenvectors of a real symmetric tridiagonal matrix by divide and conquer.
+     *
+     * On return \c d holds the eigenvalues in increasing order and the columns
+     * of \c z, n x n, the corresponding orthonormal eigenvectors; \c e is left
+     * unchanged. The matrix is split in halves coupled by a rank one term down
+     * to blocks of order 25, which go to the QL iteration; each merge solves
+     * the secular equation of the rank one update after deflation and
+     * multiplies the eigenvectors of the halves by its eigenvectors.
+     *
+     * \return 0 on success, else one plus the index of an eigenvalue that did not converge.
+     */
+    template<class VD, class VE, class MZ>
+    typename VD::size_type tridiagonal_eigen (VD &d, const VE &e, MZ &z) {
+        typedef typename VD::size_type size_type;
+        typedef typename VD::value_type value_type;
+        typedef vector<value_type> vector_type;
+
+        const size_type size = d.size ();
+        BOOST_UBLAS_CHECK (e.size () + 1 == size || (size == 0 && e.size () == 0), bad_size ());
+        BOOST_UBLAS_CHECK (z.size1 () == size && z.size2 () == size, bad_size ());
+        if (size == 0)
+            return 0;
+        // scaled to norm one for the tolerances of the merges
+        const value_type scale = (std::max) (norm_inf (d), size > 1 ? norm_inf (e) : value_type/*zero*/());
+        if (scale == value_type/*zero*/()) {
+            z.assign (identity_matrix<value_type> (size));
+            return 0;
+        }
+        vector_type ds (d / scale), es (size - 1);
+        for (size_type i = 0; i + 1 < size; ++ i)
+            es (i) = e (i) / scale;
+        matrix<value_type, column_major> q (size, size);
+        q.clear ();
+        const size_type info = detail::tridiagonal_divide (ds, static_cast<const vector_type &> (es), q, 0, size);
+        if (info != 0)
+            return info;
+        d.assign (ds * scale);
+        z.assign (q);
+        return 0;
+    }
+
+    /** \brief Eigenvalues of a real symmetric matrix.
+     *
+     * \c a may be stored in any form, e.g. as a packed symmetric_matrix; it is
+     * copied into a dense column major matrix, reduced by
+     * symmetric_tridiagonalize and the tridiagonal eigenvalues are computed by
+     * the QL iteration. \c w receives the eigenvalues in increasing order.
+     *
+     * \return 0 on success, else one plus the index of an eigenvalue that did not converge.
+     */
+    template<class E, class V>
+    typename E::size_type symmetric_eigen (const matrix_expression<E> &a, V &w) {
+        typedef typename E::size_type size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a ().size1 () == a ().size2 (), bad_size ());
+        const size_type size = a ().size1 ();
+        BOOST_UBLAS_CHECK (w.size () == size, bad_size ());
+        matrix<value_type, column_major> m (a ());
+        vector<value_type> d (size), e (size > 0 ? size - 1 : 0), tau (e.size ());
+        symmetric_tridiagonalize (m, d, e, tau);
+        const size_type info = tridiagonal_eigen (d, e);
+        w.assign (d);
+        return info;
+    }
+
+    /** \brief Eigenvalues and eigenvectors of a real symmetric matrix.
+     *
+     * As symmetric_eigen (a, w), with the tridiagonal matrix diagonalized by
+     * divide and conquer; the columns of \c z, n x n, receive the orthonormal
+     * eigenvectors.
+     *
+     * \return 0 on success, else one plus the index of an eigenvalue that did not converge.
+     */
+    template<class E, class V, class MZ>
+    typename E::size_type symmetric_eigen (const matrix_expression<E> &a, V &w, MZ &z, typename E::size_type block_size = 32) {
+        typedef typename E::size_type size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a ().size1 () == a ().size2 (), bad_size ());
+        const size_type size = a ().size1 ();
+        BOOST_UBLAS_CHECK (w.size () == size, bad_size ());
+        BOOST_UBLAS_CHECK (z.size1 () == size && z.size2 () == size, bad_size ());
+        matrix<value_type, column_major> m (a ());
+        vector<value_type> d (size), e (size > 0 ? size - 1 : 0), tau (e.size ());
+        symmetric_tridiagonalize (m, d, e, tau, block_size);
+        matrix<value_type, column_major> q (size, size);
+        const size_type info = tridiagonal_eigen (d, e, q);
+        if (info != 0)
+            return info;
+        detail::tridiagonal_back_transform (m, tau, q, block_size);
+        w.assign (d);
+        z.assign (q);
+        return 0;
+    }
+
+    /** \brief Largest eigenvalues and their eigenvectors of a real symmetric matrix.
+     *
+     * Computes the k = w.size () largest eigenvalues, in decreasing order, and
+     * their orthonormal eigenvectors in the columns of \c z, n x k, as needed
+     * e.g. for principal component analysis. After the reduction to
+     * tridiagonal form the eigenvalues are located by bisection and the
+     * eigenvectors found by inverse iteration, in the spirit of LAPACK's SYEVX,
+     * and only these k vectors are transformed back.
+     */
+    template<class E, class V, class MZ>
+    void symmetric_eigen_largest (const matrix_expression<E> &a, V &w, MZ &z, typename E::size_type block_size = 32) {
+        typedef typename E::size_type size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (a ().size1 () == a ().size2 (), bad_size ());
+        const size_type size = a ().size1 (), count = w.size ();
+        BOOST_UBLAS_CHECK (count <= size, bad_size ());
+        BOOST_UBLAS_CHECK (z.size1 () == size && z.size2 () == count, bad_size ());
+        if (count == 0)
+            return;
+        matrix<value_type, column_major> m (a ());
+        vector<value_type> d (size), e (size - 1), tau (size - 1);
+        symmetric_tridiagonalize (m, d, e, tau, block_size);
+        vector<value_type> lambda (count);
+#pragma omp parallel for if (size * count > detail::kernel_parallel_work / 64)
+        for (size_type j = 0; j < count; ++ j)
+            lambda (j) = detail::tridiagonal_bisect (d, e, size - 1 - j);
+        matrix<value_type, column_major> q (size, count);
+        detail::tridiagonal_inverse_iteration (d, e, lambda, q);
+        detail::tridiagonal_back_transform (m, tau, q, block_size);
+        w.assign (lambda);
+        z.assign (q);
+    }
+
+}}}
+
+#endif
@@ -13,9 +13,172 @@
 #ifndef BOOST_UBLAS_TENSOR_ALGORITHMS_HPP
 #define BOOST_UBLAS_TENSOR_ALGORITHMS_HPP
 
+#include <algorithm>
 #include <complex>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace boost::numeric::ublas::detail {
+
+// edge of the square tiles of the blocked transposition
+inline constexpr std::size_t transpose_tile = 32;
+// number of elements from which the transposition is split between threads
+inline constexpr std::size_t transpose_parallel_size = std::size_t(1) << 16;
+
+
+/** @brief Extent of a mode with its strides in the output and in the input tensor */
+template <class SizeType>
+struct transpose_mode
+{
+  SizeType extent;
+  SizeType wc;
+  SizeType wa;
+};
+
+
+/** @brief Copies a tile spanned by the modes with the smallest input and output stride
+ *
+ * Implements C[i,j] = op( A[i,j] ) for 0 <= i < ni and 0 <= j < nj
+ *
+ * Full tiles are read along i into a local buffer and written along j. Their extents are
+ * known at compile time such that the compiler can turn the micro-transposition into vector shuffles.
+*/
+template <class PointerOut, class PointerIn, class SizeType, class UnaryOp>
+void transpose_tile_copy(SizeType const ni, SizeType const nj,
+                         PointerOut c, SizeType const wci, SizeType const wcj,
+                         PointerIn a,  SizeType const wai, SizeType const waj,
+                         UnaryOp op)
+{
+  using value_type = std::remove_cv_t<std::remove_pointer_t<PointerOut>>;
+  constexpr auto b = transpose_tile;
+
+  if(ni == b && nj == b){
+    value_type t[b][b];
+    for(auto j = 0u; j < b; ++j)
+      for(auto i = 0u; i < b; ++i)
+        t[j][i] = op(a[i*wai + j*waj]);
+    for(auto i = 0u; i < b; ++i)
+      for(auto j = 0u; j < b; ++j)
+        c[i*wci + j*wcj] = t[j][i];
+    return;
+  }
+
+  for(SizeType j = 0u; j < nj; ++j)
+    for(SizeType i = 0u; i < ni; ++i)
+      c[i*wci + j*wcj] = op(a[i*wai + j*waj]);
+}
+
+
+/** @brief Copies a tensor into a tensor with permuted strides applying a unary operation
+ *
+ * Implements C[i1,i2,...,ip] = op( A[i1,i2,...,ip] ) where the strides of C are given for the modes of A
+ *
+ * Modes of extent one are dropped and modes that are contiguous in both tensors are merged.
+ * If the same mode has the smallest stride in A and C, it is copied with an innermost unit-stride loop.
+ * Otherwise the two modes with the smallest strides are copied in tiles of transpose_tile x transpose_tile.
+ * The remaining modes are looped over in descending order of their output stride, the outermost
+ * loop, or the tiles if there is none, being split between threads.
+ *
+ * @param[in]  p  rank of input and output tensor
+ * @param[in]  n  pointer to the extents of the input tensor of length p
+ * @param[out] c  pointer to the output tensor
+ * @param[in]  wc pointer to the strides of the output tensor for the modes of a
+ * @param[in]  a  pointer to the input tensor
+ * @param[in]  wa pointer to the strides of the input tensor
+ * @param[in]  op unary operation
+*/
+template <class PointerOut, class PointerIn, class SizeType, class UnaryOp>
+void transpose(SizeType const p, SizeType const*const n,
+               PointerOut c, SizeType const*const wc,
+               PointerIn a,  SizeType const*const wa,
+               UnaryOp op)
+{
+  using mode_type = transpose_mode<SizeType>;
+
+  auto size  = std::size_t(1);
+  auto modes = std::vector<mode_type>{};
+  for(auto r = 0u; r < p; ++r){
+    size *= std::size_t(n[r]);
+    if(n[r] != 1u)
+      modes.push_back({n[r], wc[r], wa[r]});
+  }
+  if(size == 0u)
+    return;
+
+  std::sort(modes.begin(), modes.end(), [](mode_type const& l, mode_type const& r){ return l.wa < r.wa; });
+  auto fused = std::vector<mode_type>{};
+  for(auto const& mode : modes){
+    if(!fused.empty() && mode.wa == fused.back().wa*fused.back().extent && mode.wc == fused.back().wc*fused.back().extent){
+      fused.back().extent *= mode.extent;
+      continue;
+    }
+    fused.push_back(mode);
+  }
+
+  if(fused.empty()){
+    *c = op(*a);
+    return;
+  }
+
+  // fused[0] has the smallest input stride, fused[ic] the smallest output stride
+  auto const ic = std::size_t(std::min_element(fused.begin(), fused.end(), [](mode_type const& l, mode_type const& r){ return l.wc < r.wc; }) - fused.begin());
+  auto const mi = fused[0];
+  auto const mj = fused[ic];
+  auto loops = std::vector<mode_type>{};
+  for(auto r = 1u; r < fused.size(); ++r)
+    if(r != ic)
+      loops.push_back(fused[r]);
+  std::sort(loops.begin(), loops.end(), [](mode_type const& l, mode_type const& r){ return l.wc > r.wc; });
+
+  constexpr auto b = SizeType(transpose_tile);
+  auto const tiles = std::ptrdiff_t((mj.extent + b - 1) / b);
+
+  auto kernel = [&](PointerOut c, PointerIn a)
+  {
+    if(ic == 0u){
+      for(SizeType i = 0u; i < mi.extent; ++i)
+        c[i*mi.wc] = op(a[i*mi.wa]);
+      return;
+    }
+#pragma omp parallel for if (size > transpose_parallel_size && loops.empty())
+    for(std::ptrdiff_t tile = 0; tile < tiles; ++tile){
+      auto const j0 = SizeType(tile) * b;
+      auto const nj = std::min(b, SizeType(mj.extent - j0));
+      for(SizeType i0 = 0u; i0 < mi.extent; i0 += b)
+        transpose_tile_copy(std::min(b, SizeType(mi.extent - i0)), nj,
+                            c + i0*mi.wc + j0*mj.wc, mi.wc, mj.wc,
+                            a + i0*mi.wa + j0*mj.wa, mi.wa, mj.wa, op);
+    }
+  };
+
+  auto lambda = [&](auto const& self, std::size_t l, PointerOut c, PointerIn a) -> void
+  {
+    if(l == loops.size()){
+      kernel(c, a);
+      return;
+    }
+    auto const& loop = loops[l];
+    for(SizeType i = 0u; i < loop.extent; ++i, c += loop.wc, a += loop.wa)
+      self(self, l+1, c, a);
+  };
+
+  if(loops.empty()){
+    kernel(c, a);
+    return;
+  }
+
+  auto const& outer = loops.front();
+  auto const extent = std::ptrdiff_t(outer.extent);
+#pragma omp parallel for if (size > transpose_parallel_size)
+  for(std::ptrdiff_t i = 0; i < extent; ++i)
+    lambda(lambda, 1u, c + SizeType(i)*outer.wc, a + SizeType(i)*outer.wa);
+}
+
+} // namespace boost::numeric::ublas::detail
+
 
 namespace boost::numeric::ublas {
 
@@ -25,6 +188,8 @@ namespace boost::numeric::ublas {
  *
  * Implements C[i1,i2,...,ip] = A[i1,i2,...,ip]
  *
+ * @note calls detail::transpose, or copies element by element in constant evaluation
+ *
  * @param[in]  p rank of input and output tensor
  * @param[in]  n pointer to the extents of input or output tensor of length p
  * @param[in] pi pointer to a one-based permutation tuple of length p
@@ -56,22 +221,22 @@ constexpr void copy(const SizeType p, SizeType const*const n,
     throw std::runtime_error("Error in boost::numeric::ublas::copy: Pointers shall not be null pointers.");
   }
 
-  auto lambda = [n, wc, wa](auto const& self, SizeType r, PointerOut c, PointerIn a) 
-    -> void
-  {
-    if(r > 0){
-      for(auto d = 0u; d < n[r]; c += wc[r], a += wa[r], ++d){
-        self(self, r-1, c, a );
-      }
-    }
-    else{
-      for(auto d = 0u; d < n[0]; c += wc[0], a += wa[0], ++d){
-        *c = *a;
+  if(std::is_constant_evaluated()){
+    // offsets instead of advanced pointers stay within the arrays
+    auto lambda = [n, c, wc, a, wa](auto const& self, SizeType r, SizeType jc, SizeType ja)
+      -> void
+    {
+      for(auto d = 0u; d < n[r]; ++d){
+        if(r > 0)
+          self(self, r-1, jc + d*wc[r], ja + d*wa[r]);
+        else
+          c[jc + d*wc[0]] = a[ja + d*wa[0]];
       }
-    }
-  };
+    };
+    return lambda(lambda, p-1, SizeType(0), SizeType(0));
+  }
 
-  return lambda(lambda, p-1, c, a );
+  detail::transpose(p, n, c, wc, a, wa, [](auto const& x){ return x; });
 }
 
 
@@ -229,7 +394,7 @@ constexpr ValueType accumulate(SizeType const p, SizeType const*const n,
  *
  * Implements C[tau[i1],tau[i2],...,tau[ip]] = A[i1,i2,...,ip]
  *
- * @note is used in function trans
+ * @note is used in function trans and calls detail::transpose, or copies element by element in constant evaluation
  *
  * @param[in]  p rank of input and output tensor
  * @param[in] na pointer to the extents of the input tensor a of length p
@@ -267,19 +432,25 @@ constexpr void trans( SizeType const p,  SizeType const*const na, SizeType const
   if(pi == nullptr)
     throw std::runtime_error("Error in boost::numeric::ublas::trans: Pointers shall not be null pointers.");
 
+  if(std::is_constant_evaluated()){
+    auto lambda = [na, pi, c, wc, a, wa](auto const& self, SizeType r, SizeType jc, SizeType ja)
+      -> void
+    {
+      for(auto d = 0u; d < na[r]; ++d){
+        if(r > 0)
+          self(self, r-1, jc + d*wc[pi[r]-1], ja + d*wa[r]);
+        else
+          c[jc + d*wc[pi[0]-1]] = a[ja + d*wa[0]];
+      }
+    };
+    return lambda(lambda, p-1, SizeType(0), SizeType(0));
+  }
 
-  auto lambda = [na, wc, wa, pi](auto const& self, SizeType r, PointerOut c, PointerIn a) 
-    -> void
-  {
-    if(r > 0)
-      for(auto d = 0u; d < na[r]; c += wc[pi[r]-1], a += wa[r], ++d)
-        self(self,r-1, c, a);
-    else
-      for(auto d = 0u; d < na[0]; c += wc[pi[0]-1], a += wa[0], ++d)
-        *c = *a;
-  };
+  auto wcp = std::vector<SizeType>(p);
+  for(auto r = 0u; r < p; ++r)
+    wcp[r] = wc[pi[r]-1];
 
-  return lambda( lambda ,p-1, c, a );
+  detail::transpose(p, na, c, wcp.data(), a, wa, [](auto const& x){ return x; });
 }
 
 
@@ -287,7 +458,7 @@ constexpr void trans( SizeType const p,  SizeType const*const na, SizeType const
  *
  * Implements C[tau[i1],tau[i2],...,tau[ip]] = A[i1,i2,...,ip]
  *
- * @note is used in function trans
+ * @note is used in function trans and calls detail::transpose, or copies element by element in constant evaluation
  *
  * @param[in]  p rank of input and output tensor
  * @param[in] na pointer to the extents of the input tensor a of length p
@@ -321,20 +492,25 @@ constexpr void trans(SizeType const p,
     throw std::runtime_error("Error in boost::numeric::ublas::trans: Pointers shall not be null pointers.");
   }
 
+  if(std::is_constant_evaluated()){
+    auto lambda = [na, pi, c, wc, a, wa](auto const& self, SizeType r, SizeType jc, SizeType ja)
+      -> void
+    {
+      for(auto d = 0u; d < na[r]; ++d){
+        if(r > 0)
+          self(self, r-1, jc + d*wc[pi[r]-1], ja + d*wa[r]);
+        else
+          c[jc + d*wc[pi[0]-1]] = std::conj(a[ja + d*wa[0]]);
+      }
+    };
+    return lambda(lambda, p-1, SizeType(0), SizeType(0));
+  }
 
+  auto wcp = std::vector<SizeType>(p);
+  for(auto r = 0u; r < p; ++r)
+    wcp[r] = wc[pi[r]-1];
 
-  auto lambda = [na, wc, wa, pi](auto const& self, SizeType r, std::complex<ValueType>* c, std::complex<ValueType>* a)
-    ->void 
-  {
-    if(r > 0)
-      for(auto d = 0u; d < na[r]; c += wc[pi[r]-1], a += wa[r], ++d)
-        self(self,r-1, c, a);
-    else
-      for(auto d = 0u; d < na[0]; c += wc[pi[0]-1], a += wa[0], ++d)
-        *c = std::conj(*a);
-  };
-
-  return lambda( lambda ,p-1, c, a );
+  detail::transpose(p, na, c, wcp.data(), a, wa, [](std::complex<ValueType> const& x){ return std::conj(x); });
 
 }
 
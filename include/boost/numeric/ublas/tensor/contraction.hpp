@@ -0,0 +1,823 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+
+#ifndef BOOST_UBLAS_TENSOR_CONTRACTION_HPP
+#define BOOST_UBLAS_TENSOR_CONTRACTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "algorithms.hpp"
+
+namespace boost::numeric::ublas {
+
+/** @brief Algorithms of the tensor-times-tensor product
+ *
+ * recursive      scalar recursion of detail::recursive::ttt
+ * loop_over_gemm strided GEMMs over modes that are matrix-like in memory, looping over the others
+ * ttgt           transposes the operands that are not matrix-like and computes a single GEMM
+ * automatic      chooses one of the above with detail::contraction_cost
+*/
+enum class contraction_method { automatic, recursive, loop_over_gemm, ttgt };
+
+} // namespace boost::numeric::ublas
+
+
+namespace boost::numeric::ublas::detail {
+
+// register tile and cache blocks of the packed GEMM
+inline constexpr std::size_t gemm_mr = 4;
+inline constexpr std::size_t gemm_nr = 8;
+inline constexpr std::size_t gemm_mc = 128;
+inline constexpr std::size_t gemm_kc = 256;
+inline constexpr std::size_t gemm_nc = 4096;
+// number of multiply-adds from which work is split between threads
+inline constexpr double gemm_parallel_work = 64.0*64.0*64.0;
+
+
+/** @brief Packs a block of A into micro-panels of gemm_mr rows, padded with zeros
+ *
+ * @param[in]  m   number of rows of the block
+ * @param[in]  k   number of columns of the block
+ * @param[in]  a   pointer to the first element of the block
+ * @param[in]  wr  row stride of a
+ * @param[in]  wk  column stride of a
+ * @param[out] buf buffer of size ceil(m/gemm_mr)*gemm_mr*k
+*/
+template <class ValueType, class PointerIn, class SizeType>
+void gemm_pack_a(SizeType const m, SizeType const k, PointerIn a, SizeType const wr, SizeType const wk, ValueType* buf)
+{
+  for(SizeType i0 = 0u; i0 < m; i0 += gemm_mr, buf += gemm_mr*k){
+    auto const mr = std::min(SizeType(gemm_mr), SizeType(m-i0));
+    for(SizeType p = 0u; p < k; ++p){
+      for(SizeType i = 0u; i < mr; ++i)
+        buf[p*gemm_mr+i] = a[(i0+i)*wr + p*wk];
+      for(SizeType i = mr; i < gemm_mr; ++i)
+        buf[p*gemm_mr+i] = ValueType{};
+    }
+  }
+}
+
+
+/** @brief Packs a block of B into micro-panels of gemm_nr columns, padded with zeros
+ *
+ * @param[in]  k   number of rows of the block
+ * @param[in]  n   number of columns of the block
+ * @param[in]  b   pointer to the first element of the block
+ * @param[in]  wk  row stride of b
+ * @param[in]  wc  column stride of b
+ * @param[out] buf buffer of size ceil(n/gemm_nr)*gemm_nr*k
+*/
+template <class ValueType, class PointerIn, class SizeType>
+void gemm_pack_b(SizeType const k, SizeType const n, PointerIn b, SizeType const wk, SizeType const wc, ValueType* buf)
+{
+  for(SizeType j0 = 0u; j0 < n; j0 += gemm_nr, buf += gemm_nr*k){
+    auto const nr = std::min(SizeType(gemm_nr), SizeType(n-j0));
+    for(SizeType p = 0u; p < k; ++p){
+      for(SizeType j = 0u; j < nr; ++j)
+        buf[p*gemm_nr+j] = b[p*wk + (j0+j)*wc];
+      for(SizeType j = nr; j < gemm_nr; ++j)
+        buf[p*gemm_nr+j] = ValueType{};
+    }
+  }
+}
+
+
+/** @brief Multiplies a packed micro-panel of A with a packed micro-panel of B
+ *
+ * Implements C[i,j] += sum(A[i,p] * B[p,j]) for the mr x nr tile of C
+*/
+template <class ValueType, class PointerOut, class SizeType>
+void gemm_micro(SizeType const k, ValueType const* a, ValueType const* b,
+                PointerOut c, SizeType const wr, SizeType const wc,
+                SizeType const mr, SizeType const nr)
+{
+  ValueType t[gemm_mr][gemm_nr] = {};
+  for(SizeType p = 0u; p < k; ++p, a += gemm_mr, b += gemm_nr)
+    for(auto i = 0u; i < gemm_mr; ++i){
+      auto const ai = a[i];
+      for(auto j = 0u; j < gemm_nr; ++j)
+        t[i][j] += ai * b[j];
+    }
+
+  for(SizeType i = 0u; i < mr; ++i)
+    for(SizeType j = 0u; j < nr; ++j)
+      c[i*wr + j*wc] += t[i][j];
+}
+
+
+/** @brief Computes the matrix-times-matrix product with arbitrary strides
+ *
+ * Implements C[i,j] += sum(A[i,p] * B[p,j])
+ *
+ * Blocks of A and B are packed into contiguous micro-panels so that
+ * the strides of the operands only affect the packing.
+ *
+ * @param[in]  m   number of rows of A and C
+ * @param[in]  n   number of columns of B and C
+ * @param[in]  k   number of columns of A and rows of B
+ * @param[out] c   pointer to the output matrix C
+ * @param[in]  wcr row stride of C
+ * @param[in]  wcc column stride of C
+ * @param[in]  a   pointer to the first input matrix A
+ * @param[in]  war row stride of A
+ * @param[in]  wac column stride of A
+ * @param[in]  b   pointer to the second input matrix B
+ * @param[in]  wbr row stride of B
+ * @param[in]  wbc column stride of B
+*/
+template <class PointerOut, class PointerIn1, class PointerIn2, class SizeType>
+void gemm(SizeType const m, SizeType const n, SizeType const k,
+          PointerOut c, SizeType const wcr, SizeType const wcc,
+          PointerIn1 a, SizeType const war, SizeType const wac,
+          PointerIn2 b, SizeType const wbr, SizeType const wbc)
+{
+  using value_type = std::remove_cv_t<std::remove_pointer_t<PointerOut>>;
+
+  if(m == 0u || n == 0u || k == 0u)
+    return;
+
+  auto const blocks = std::ptrdiff_t((m + gemm_mc - 1) / gemm_mc);
+  auto bp = std::vector<value_type>{};
+
+  for(SizeType j0 = 0u; j0 < n; j0 += gemm_nc){
+    auto const nb = std::min(SizeType(gemm_nc), SizeType(n-j0));
+    for(SizeType p0 = 0u; p0 < k; p0 += gemm_kc){
+      auto const kb = std::min(SizeType(gemm_kc), SizeType(k-p0));
+      bp.resize((nb + gemm_nr - 1) / gemm_nr * gemm_nr * kb);
+      gemm_pack_b(kb, nb, b + p0*wbr + j0*wbc, wbr, wbc, bp.data());
+
+#pragma omp parallel if (double(m) * double(n) * double(k) > gemm_parallel_work && blocks > 1)
+      {
+        auto ap = std::vector<value_type>(gemm_mc * kb);
+#pragma omp for schedule (dynamic)
+        for(std::ptrdiff_t block = 0; block < blocks; ++block){
+          auto const i0 = SizeType(block) * gemm_mc;
+          auto const mb = std::min(SizeType(gemm_mc), SizeType(m-i0));
+          gemm_pack_a(mb, kb, a + i0*war + p0*wac, war, wac, ap.data());
+          for(SizeType jr = 0u; jr < nb; jr += gemm_nr){
+            auto const nr = std::min(SizeType(gemm_nr), SizeType(nb-jr));
+            for(SizeType ir = 0u; ir < mb; ir += gemm_mr){
+              auto const mr = std::min(SizeType(gemm_mr), SizeType(mb-ir));
+              gemm_micro(kb, ap.data() + ir*kb, bp.data() + jr*kb,
+                         c + (i0+ir)*wcr + (j0+jr)*wcc, wcr, wcc, mr, nr);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+
+/** @brief Extent of a mode with its strides in the two tensors that share it
+ *
+ * free modes of A:  strides of A and C
+ * free modes of B:  strides of B and C
+ * contracted modes: strides of A and B
+*/
+template <class SizeType>
+struct contraction_mode
+{
+  SizeType extent;
+  SizeType stride1;
+  SizeType stride2;
+  SizeType index1;
+  SizeType index2;
+};
+
+
+/** @brief Modes of a tensor-times-tensor product without the modes of extent one */
+template <class SizeType>
+struct contraction_modes
+{
+  std::vector<contraction_mode<SizeType>> free_a;
+  std::vector<contraction_mode<SizeType>> free_b;
+  std::vector<contraction_mode<SizeType>> contracted;
+};
+
+
+template <class SizeType>
+auto make_contraction_modes(SizeType const r, SizeType const s, SizeType const q,
+                            SizeType const*const phia, SizeType const*const phib,
+                            SizeType const*const nc, SizeType const*const wc,
+                            SizeType const*const na, SizeType const*const wa,
+                            SizeType const*const wb)
+{
+  auto modes = contraction_modes<SizeType>{};
+  for(auto i = 0ul; i < r; ++i)
+    if(nc[i] != 1u)
+      modes.free_a.push_back({nc[i], wa[phia[i]-1], wc[i], SizeType(phia[i]-1), SizeType(i)});
+  for(auto i = 0ul; i < s; ++i)
+    if(nc[r+i] != 1u)
+      modes.free_b.push_back({nc[r+i], wb[phib[i]-1], wc[r+i], SizeType(phib[i]-1), SizeType(r+i)});
+  for(auto i = 0ul; i < q; ++i)
+    if(na[phia[r+i]-1] != 1u)
+      modes.contracted.push_back({na[phia[r+i]-1], wa[phia[r+i]-1], wb[phib[s+i]-1], SizeType(phia[r+i]-1), SizeType(phib[s+i]-1)});
+  return modes;
+}
+
+
+template <class SizeType>
+auto extent_product(std::vector<contraction_mode<SizeType>> const& modes)
+{
+  auto n = 1.0;
+  for(auto const& mode : modes)
+    n *= double(mode.extent);
+  return n;
+}
+
+
+/** @brief Merges modes that are contiguous in both tensors into single modes
+ *
+ * The modes are ordered by their stride in the first tensor. A mode is merged with
+ * its predecessor if both of its strides equal the stride of the predecessor times its extent.
+*/
+template <class SizeType>
+auto fuse_modes(std::vector<contraction_mode<SizeType>> modes)
+{
+  std::sort(modes.begin(), modes.end(), [](contraction_mode<SizeType> const& l, contraction_mode<SizeType> const& r){ return l.stride1 < r.stride1; });
+  auto fused = std::vector<contraction_mode<SizeType>>{};
+  for(auto const& mode : modes){
+    if(!fused.empty()){
+      auto& last = fused.back();
+      if(mode.stride1 == last.stride1*last.extent && mode.stride2 == last.stride2*last.extent){
+        last.extent *= mode.extent;
+        continue;
+      }
+    }
+    fused.push_back(mode);
+  }
+  return fused;
+}
+
+
+/** @brief Loop around the GEMMs of the loop-over-GEMM contraction */
+template <class SizeType>
+struct gemm_loop
+{
+  SizeType extent;
+  SizeType wa;
+  SizeType wb;
+  SizeType wc;
+};
+
+
+/** @brief Matrix dimensions and loops of the loop-over-GEMM contraction
+ *
+ * m is a free mode of A with the strides of A and C,
+ * n is a free mode of B with the strides of B and C and
+ * k is a contracted mode with the strides of A and B.
+*/
+template <class SizeType>
+struct loop_over_gemm_plan
+{
+  contraction_mode<SizeType> m;
+  contraction_mode<SizeType> n;
+  contraction_mode<SizeType> k;
+  std::vector<gemm_loop<SizeType>> loops;
+  double batches;
+};
+
+
+/** @brief Selects the largest fused mode of each kind as GEMM dimension and loops over the remaining modes
+ *
+ * Loops over free modes come first so that the outermost loop can be run in parallel.
+*/
+template <class SizeType>
+auto make_loop_over_gemm_plan(contraction_modes<SizeType> const& modes)
+{
+  auto plan = loop_over_gemm_plan<SizeType>{};
+  plan.batches = 1.0;
+
+  auto select = [&plan](auto fused, auto make_loop) {
+    auto const none = contraction_mode<SizeType>{1u,0u,0u,0u,0u};
+    if(fused.empty())
+      return none;
+    auto largest = std::max_element(fused.begin(), fused.end(), [](contraction_mode<SizeType> const& l, contraction_mode<SizeType> const& r){ return r.extent > l.extent; });
+    auto const mode = *largest;
+    fused.erase(largest);
+    for(auto const& other : fused){
+      plan.loops.push_back(make_loop(other));
+      plan.batches *= double(other.extent);
+    }
+    return mode;
+  };
+
+  plan.m = select(fuse_modes(modes.free_a),     [](auto const& x){ return gemm_loop<SizeType>{x.extent, x.stride1, 0u, x.stride2}; });
+  plan.n = select(fuse_modes(modes.free_b),     [](auto const& x){ return gemm_loop<SizeType>{x.extent, 0u, x.stride1, x.stride2}; });
+  plan.k = select(fuse_modes(modes.contracted), [](auto const& x){ return gemm_loop<SizeType>{x.extent, x.stride1, x.stride2, 0u}; });
+
+  std::stable_sort(plan.loops.begin(), plan.loops.end(), [](gemm_loop<SizeType> const& l, gemm_loop<SizeType> const& r){ return l.wc != 0u && r.wc == 0u; });
+  return plan;
+}
+
+
+/** @brief Mode orders and copies of the transpose-transpose-GEMM-transpose contraction
+ *
+ * A is used as a (free_a x contracted) matrix, B as a (contracted x free_b) matrix and C as a (free_a x free_b) matrix.
+ * An operand is copied into a contiguous buffer if its modes are not contiguous in the given orders.
+*/
+template <class SizeType>
+struct ttgt_plan
+{
+  std::vector<contraction_mode<SizeType>> free_a;
+  std::vector<contraction_mode<SizeType>> free_b;
+  std::vector<contraction_mode<SizeType>> contracted;
+  bool copy_a;
+  bool copy_b;
+  bool copy_c;
+};
+
+
+/** @brief Returns true if the modes, in the given order, form a single contiguous mode with respect to the given stride */
+template <class SizeType, class Stride>
+bool is_contiguous(std::vector<contraction_mode<SizeType>> const& modes, Stride stride)
+{
+  for(auto i = 1ul; i < modes.size(); ++i)
+    if(modes[i].*stride != modes[i-1].*stride * modes[i-1].extent)
+      return false;
+  return true;
+}
+
+
+template <class SizeType, class Stride>
+auto sorted_modes(std::vector<contraction_mode<SizeType>> modes, Stride stride)
+{
+  std::stable_sort(modes.begin(), modes.end(), [stride](contraction_mode<SizeType> const& l, contraction_mode<SizeType> const& r){ return l.*stride < r.*stride; });
+  return modes;
+}
+
+
+/** @brief Orders the modes such that the output and then the inputs need as few copies as possible */
+template <class SizeType>
+auto make_ttgt_plan(contraction_modes<SizeType> const& modes)
+{
+  using mode_type = contraction_mode<SizeType>;
+  auto plan = ttgt_plan<SizeType>{};
+
+  plan.free_a = sorted_modes(modes.free_a, &mode_type::stride2);
+  plan.free_b = sorted_modes(modes.free_b, &mode_type::stride2);
+  plan.copy_c = !is_contiguous(plan.free_a, &mode_type::stride2) || !is_contiguous(plan.free_b, &mode_type::stride2);
+  if(plan.copy_c){
+    plan.free_a = sorted_modes(modes.free_a, &mode_type::stride1);
+    plan.free_b = sorted_modes(modes.free_b, &mode_type::stride1);
+  }
+
+  plan.contracted = sorted_modes(modes.contracted, &mode_type::stride1);
+  if(!is_contiguous(plan.contracted, &mode_type::stride1))
+    plan.contracted = sorted_modes(modes.contracted, &mode_type::stride2);
+
+  plan.copy_a = !is_contiguous(plan.free_a, &mode_type::stride1) || !is_contiguous(plan.contracted, &mode_type::stride1);
+  plan.copy_b = !is_contiguous(plan.free_b, &mode_type::stride1) || !is_contiguous(plan.contracted, &mode_type::stride2);
+  return plan;
+}
+
+
+/** @brief Estimated number of cycles of a single call of gemm
+ *
+ * Accounts for the multiply-adds on padded micro-tiles, packing, updates of C and the call overhead.
+*/
+inline double gemm_cost(double const m, double const n, double const k)
+{
+  auto const mp = std::ceil(m/double(gemm_mr)) * double(gemm_mr);
+  auto const np = std::ceil(n/double(gemm_nr)) * double(gemm_nr);
+  auto const updates = mp*np*std::ceil(k/double(gemm_kc));
+  return mp*np*k/4.0 + m*k*std::ceil(n/double(gemm_nc)) + k*n + updates + 256.0;
+}
+
+
+/** @brief Estimated number of cycles of the scalar recursion for C[m x n] += A[m x k] * B[k x n]
+ *
+ * The scalar recursion performs a strided load of A and B per multiply-add.
+*/
+inline double recursive_cost(double const m, double const n, double const k)
+{
+  return 2.0*m*n*k + m*n;
+}
+
+
+template <class SizeType>
+double loop_over_gemm_cost(loop_over_gemm_plan<SizeType> const& plan)
+{
+  return plan.batches * gemm_cost(double(plan.m.extent), double(plan.n.extent), double(plan.k.extent));
+}
+
+
+/** @brief Maps the mode-m tensor-times-matrix product onto strided GEMMs
+ *
+ * Implements C[i1,...,im-1,j,im+1,...,ip] = sum(A[i1,...,im,...,ip] * B[j,im])
+ *
+ * The free modes of A are merged where they are contiguous in A and C. Each GEMM multiplies a merged
+ * mode of A with the transposed B and the plan loops over the other merged modes. The merged mode
+ * with the least estimated cost is selected: for m = 1 and first-order storage all free modes merge
+ * into one and the product is a single GEMM, otherwise GEMMs are batched over the outer modes.
+ *
+ * @param m  one-based contraction mode with 1 <= m <= p
+ * @param p  rank of the tensors A and C
+*/
+template <class SizeType>
+auto make_ttm_plan(SizeType const m, SizeType const p,
+                   SizeType const*const wc,
+                   SizeType const*const na, SizeType const*const wa,
+                   SizeType const*const nb, SizeType const*const wb)
+{
+  auto free = std::vector<contraction_mode<SizeType>>{};
+  for(auto r = 0ul; r < p; ++r)
+    if(r != m-1 && na[r] != 1u)
+      free.push_back({na[r], wa[r], wc[r], SizeType(r), SizeType(r)});
+  free = fuse_modes(std::move(free));
+
+  auto plan = loop_over_gemm_plan<SizeType>{};
+  plan.m = contraction_mode<SizeType>{1u,0u,0u,0u,0u};
+  plan.n = contraction_mode<SizeType>{nb[0], wb[0], wc[m-1], SizeType(m-1), SizeType(m-1)};
+  plan.k = contraction_mode<SizeType>{na[m-1], wa[m-1], wb[1], SizeType(m-1), SizeType(m-1)};
+  plan.batches = extent_product(free);
+
+  // packing A or writing C without a unit-stride dimension touches a cache line per element
+  auto cost_of = [&plan](contraction_mode<SizeType> const& mode, double const batches){
+    auto const m = double(mode.extent), n = double(plan.n.extent), k = double(plan.k.extent);
+    auto cost = gemm_cost(m, n, k);
+    if(mode.stride1 != 1u && plan.k.stride1 != 1u) cost += 4.0*m*k;
+    if(mode.stride2 != 1u && plan.n.stride2 != 1u) cost += 4.0*m*n;
+    return batches * cost;
+  };
+
+  auto const all = plan.batches;
+  auto cost = cost_of(plan.m, all);
+  auto selected = free.size();
+  for(auto i = 0ul; i < free.size(); ++i){
+    auto const c = cost_of(free[i], all / double(free[i].extent));
+    if(c < cost){
+      selected = i;
+      cost = c;
+    }
+  }
+  if(selected < free.size()){
+    plan.m = free[selected];
+    plan.batches = all / double(plan.m.extent);
+    free.erase(free.begin() + selected);
+  }
+
+  // the outermost loop runs over the largest strides and is run in parallel
+  for(auto it = free.rbegin(); it != free.rend(); ++it)
+    plan.loops.push_back({it->extent, it->stride1, 0u, it->stride2});
+  return plan;
+}
+
+
+/** @brief Estimated number of cycles of the contraction for the given method
+ *
+ * The transposition of an operand costs a strided read and a write per element.
+*/
+template <class SizeType>
+double contraction_cost(contraction_method const method, contraction_modes<SizeType> const& modes)
+{
+  auto const m = extent_product(modes.free_a);
+  auto const n = extent_product(modes.free_b);
+  auto const k = extent_product(modes.contracted);
+
+  if(method == contraction_method::loop_over_gemm)
+    return loop_over_gemm_cost(make_loop_over_gemm_plan(modes));
+  if(method == contraction_method::ttgt){
+    auto const plan = make_ttgt_plan(modes);
+    auto copies = 0.0;
+    if(plan.copy_a) copies += m*k;
+    if(plan.copy_b) copies += k*n;
+    if(plan.copy_c) copies += 2.0*m*n;
+    return gemm_cost(m, n, k) + 2.0*copies;
+  }
+  return recursive_cost(m, n, k);
+}
+
+
+/** @brief Chooses the contraction method with the least estimated cost */
+template <class SizeType>
+contraction_method choose_contraction_method(contraction_modes<SizeType> const& modes)
+{
+  auto method = contraction_method::recursive;
+  auto cost   = contraction_cost(method, modes);
+  for(auto other : {contraction_method::loop_over_gemm, contraction_method::ttgt}){
+    auto const c = contraction_cost(other, modes);
+    if(c < cost){
+      method = other;
+      cost   = c;
+    }
+  }
+  return method;
+}
+
+
+/** @brief Computes the tensor-times-tensor product with GEMMs over the matrix-like modes
+ *
+ * @note is used in functions ttt and ttm
+*/
+template <class PointerOut, class PointerIn1, class PointerIn2, class SizeType>
+void loop_over_gemm(loop_over_gemm_plan<SizeType> const& plan, PointerOut c, PointerIn1 a, PointerIn2 b)
+{
+  auto const& loops = plan.loops;
+  auto const& m = plan.m;
+  auto const& n = plan.n;
+  auto const& k = plan.k;
+
+  auto lambda = [&](auto const& self, std::size_t l, PointerOut c, PointerIn1 a, PointerIn2 b) -> void
+  {
+    if(l == loops.size()){
+      gemm(m.extent, n.extent, k.extent,
+           c, m.stride2, n.stride2,
+           a, m.stride1, k.stride1,
+           b, k.stride2, n.stride1);
+      return;
+    }
+    auto const& loop = loops[l];
+    for(SizeType i = 0u; i < loop.extent; ++i, c += loop.wc, a += loop.wa, b += loop.wb)
+      self(self, l+1, c, a, b);
+  };
+
+  if(loops.empty() || loops.front().wc == 0u){
+    lambda(lambda, 0u, c, a, b);
+    return;
+  }
+
+  // the outermost loop writes disjoint parts of C and is split when the GEMMs are not
+  auto const& outer = loops.front();
+  auto const extent = std::ptrdiff_t(outer.extent);
+#pragma omp parallel for if (double(m.extent) * double(n.extent) * double(k.extent) <= gemm_parallel_work && \
+                             double(m.extent) * double(n.extent) * double(k.extent) * plan.batches > gemm_parallel_work)
+  for(std::ptrdiff_t i = 0; i < extent; ++i)
+    lambda(lambda, 1u, c + SizeType(i)*outer.wc, a + SizeType(i)*outer.wa, b + SizeType(i)*outer.wb);
+}
+
+
+/** @brief Computes the tensor-times-tensor product by transposing operands into matrices and a single GEMM
+ *
+ * @note is used in function ttt
+*/
+template <class PointerOut, class PointerIn1, class PointerIn2, class SizeType>
+void ttgt(ttgt_plan<SizeType> const& plan, SizeType const pa, SizeType const pb, SizeType const pc,
+          PointerOut c, SizeType const*const nc, SizeType const*const wc,
+          PointerIn1 a, SizeType const*const na, SizeType const*const wa,
+          PointerIn2 b, SizeType const*const nb, SizeType const*const wb)
+{
+  using value_type = std::remove_cv_t<std::remove_pointer_t<PointerOut>>;
+  using mode_type  = contraction_mode<SizeType>;
+  using modes_type = std::vector<mode_type>;
+
+  auto const m = SizeType(extent_product(plan.free_a));
+  auto const n = SizeType(extent_product(plan.free_b));
+  auto const k = SizeType(extent_product(plan.contracted));
+
+  // assigns contiguous strides to the modes, starting with stride w
+  auto assign = [](std::vector<SizeType>& w, modes_type const& modes, SizeType mode_type::* index, SizeType stride){
+    for(auto const& mode : modes){
+      w[mode.*index] = stride;
+      stride *= mode.extent;
+    }
+  };
+  auto first = [](modes_type const& modes, SizeType mode_type::* stride){
+    return modes.empty() ? SizeType(1) : modes.front().*stride;
+  };
+
+  // A as (free_a x contracted) matrix with the free modes first
+  auto at = std::vector<value_type>{};
+  auto war = first(plan.free_a, &mode_type::stride1), wak = first(plan.contracted, &mode_type::stride1);
+  value_type const* ap = a;
+  if(plan.copy_a){
+    at.resize(m*k);
+    auto wt = std::vector<SizeType>(pa, 0u);
+    assign(wt, plan.free_a, &mode_type::index1, 1u);
+    assign(wt, plan.contracted, &mode_type::index1, m);
+    copy(pa, na, at.data(), wt.data(), a, wa);
+    war = 1u, wak = m, ap = at.data();
+  }
+
+  // B as (contracted x free_b) matrix with the free modes first
+  auto bt = std::vector<value_type>{};
+  auto wbk = first(plan.contracted, &mode_type::stride2), wbc = first(plan.free_b, &mode_type::stride1);
+  value_type const* bp = b;
+  if(plan.copy_b){
+    bt.resize(k*n);
+    auto wt = std::vector<SizeType>(pb, 0u);
+    assign(wt, plan.free_b, &mode_type::index1, 1u);
+    assign(wt, plan.contracted, &mode_type::index2, n);
+    copy(pb, nb, bt.data(), wt.data(), b, wb);
+    wbk = n, wbc = 1u, bp = bt.data();
+  }
+
+  if(!plan.copy_c){
+    gemm(m, n, k,
+         c,  first(plan.free_a, &mode_type::stride2), first(plan.free_b, &mode_type::stride2),
+         ap, war, wak,
+         bp, wbk, wbc);
+    return;
+  }
+
+  // C as (free_a x free_b) matrix with the free modes of B first, added to C afterwards
+  auto ct = std::vector<value_type>(m*n);
+  auto wt = std::vector<SizeType>(pc, 0u);
+  assign(wt, plan.free_b, &mode_type::index2, 1u);
+  assign(wt, plan.free_a, &mode_type::index2, n);
+  gemm(m, n, k, ct.data(), n, SizeType(1), ap, war, wak, bp, wbk, wbc);
+
+  auto add = [nc, wc, &wt](auto const& self, SizeType r, PointerOut c, value_type const* t) -> void
+  {
+    if(r > 0)
+      for(auto d = 0u; d < nc[r]; c += wc[r], t += wt[r], ++d)
+        self(self, r-1, c, t);
+    else
+      for(auto d = 0u; d < nc[0]; c += wc[0], t += wt[0], ++d)
+        *c += *t;
+  };
+  add(add, pc-1, c, ct.data());
+}
+
+
+// elements of the innermost free mode that are updated while the contracted modes are iterated
+inline constexpr std::size_t ttv_block = 2048;
+// number of elements of A from which the tensor-times-vector products are split between threads
+inline constexpr double ttv_parallel_size = 65536.0;
+
+
+/** @brief Computes the dot product of a strided sequence with a contiguous vector
+ *
+ * Eight independent partial sums allow the compiler to vectorize the loop if wa = 1.
+*/
+template <class ValueType, class PointerIn1, class PointerIn2, class SizeType>
+ValueType ttv_dot(SizeType const n, PointerIn1 a, SizeType const wa, PointerIn2 b)
+{
+  if(wa != 1u){
+    auto t = ValueType{};
+    for(SizeType i = 0u; i < n; ++i, a += wa)
+      t += *a * b[i];
+    return t;
+  }
+
+  constexpr auto w = SizeType(8);
+  ValueType t[w] = {};
+  SizeType i = 0u;
+  for(; i + w <= n; i += w)
+    for(SizeType j = 0u; j < w; ++j)
+      t[j] += a[i+j] * b[i+j];
+  for(; i < n; ++i)
+    t[0] += a[i] * b[i];
+  for(SizeType j = 1u; j < w; ++j)
+    t[0] += t[j];
+  return t[0];
+}
+
+
+/** @brief Computes c += s*a for strided sequences, vectorized if both strides are one */
+template <class ValueType, class PointerOut, class PointerIn, class SizeType>
+void ttv_axpy(SizeType const n, ValueType const s, PointerOut c, SizeType const wc, PointerIn a, SizeType const wa)
+{
+  if(wc == 1u && wa == 1u)
+    for(SizeType i = 0u; i < n; ++i)
+      c[i] += s * a[i];
+  else
+    for(SizeType i = 0u; i < n; ++i, c += wc, a += wa)
+      *c += s * *a;
+}
+
+
+/** @brief Loop of the tensor-times-vector products
+ *
+ * vector is the position of the vector for a contracted mode and q for a free mode.
+ * A chunk loop iterates over blocks of ttv_block elements of the innermost free mode.
+*/
+template <class SizeType>
+struct ttv_loop
+{
+  SizeType extent;
+  SizeType wa;
+  SizeType wc;
+  SizeType vector;
+  bool chunk;
+};
+
+
+/** @brief Computes the tensor-times-vector products with q vectors in one pass over A
+ *
+ * Implements C[i1,...,ip without im1,...,imq] = sum(A[i1,...,ip] * b1[im1] * ... * bq[imq])
+ *
+ * The modes are iterated in the memory order of A. If the innermost mode is contracted, every element of C
+ * is a dot product over a contiguous sequence of A. Otherwise, every element of a vector scales a contiguous
+ * slab of A that is added to C, where the slab is split into blocks that stay in cache while the contracted
+ * modes are iterated. The free mode with the largest stride is split between threads.
+ *
+ * @note is used in functions ttv and multi_ttv
+ *
+ * @param q      number of contracted modes with q > 0
+ * @param modes  pointer to the q distinct one-based contracted modes
+ * @param p      rank of the tensor A
+ * @param c      pointer to the output tensor C
+ * @param wc     pointer to the strides of the p-q modes of C, which are the free modes of A in order
+ * @param a      pointer to the input tensor A
+ * @param na     pointer to the extents of A
+ * @param wa     pointer to the strides of A
+ * @param b      pointer to q pointers to the contiguous vectors, b[k] with na[modes[k]-1] elements
+*/
+template <class PointerOut, class PointerIn1, class PointerIn2, class SizeType>
+void fused_ttv(SizeType const q, SizeType const*const modes, SizeType const p,
+               PointerOut c, SizeType const*const wc,
+               PointerIn1 a, SizeType const*const na, SizeType const*const wa,
+               PointerIn2 const*const b)
+{
+  using value_type = std::remove_cv_t<std::remove_pointer_t<PointerOut>>;
+  using loop_type  = ttv_loop<SizeType>;
+
+  // vector of each mode of A and the weight of the contracted modes with extent one
+  auto vector = std::vector<SizeType>(p, q);
+  for(SizeType k = 0u; k < q; ++k)
+    vector[modes[k]-1] = k;
+
+  auto w0 = value_type{1};
+  auto free = std::vector<contraction_mode<SizeType>>{};
+  auto loops = std::vector<loop_type>{};
+  for(SizeType r = 0u, j = 0u; r < p; ++r){
+    if(vector[r] == q){
+      if(na[r] != 1u)
+        free.push_back({na[r], wa[r], wc[j], r, r});
+      ++j;
+    }
+    else if(na[r] != 1u)
+      loops.push_back({na[r], wa[r], 0u, vector[r], false});
+    else
+      w0 *= b[vector[r]][0];
+  }
+  for(auto const& mode : fuse_modes(std::move(free)))
+    loops.push_back({mode.extent, mode.stride1, mode.stride2, q, false});
+
+  if(loops.empty()){
+    *c += w0 * *a;
+    return;
+  }
+
+  auto size = 1.0;
+  for(auto const& loop : loops)
+    size *= double(loop.extent);
+
+  // memory order of A with the innermost mode as leaf
+  std::sort(loops.begin(), loops.end(), [](loop_type const& l, loop_type const& r){ return l.wa > r.wa; });
+  auto inner = loops.back();
+  loops.pop_back();
+
+  auto is_free = [q](loop_type const& loop){ return loop.vector == q; };
+  auto contracted = std::find_if(loops.begin(), loops.end(), [q](loop_type const& loop){ return loop.vector != q; });
+  if(is_free(inner) && inner.extent > ttv_block && contracted != loops.end()){
+    auto const chunks = (inner.extent + SizeType(ttv_block) - 1u) / SizeType(ttv_block);
+    loops.insert(contracted, loop_type{chunks, SizeType(ttv_block)*inner.wa, SizeType(ttv_block)*inner.wc, q, true});
+  }
+
+  auto lambda = [&](auto const& self, std::size_t l, PointerOut c, PointerIn1 a, value_type const w, SizeType const n) -> void
+  {
+    if(l == loops.size()){
+      if(is_free(inner))
+        ttv_axpy(n, w, c, inner.wc, a, inner.wa);
+      else
+        *c += w * ttv_dot<value_type>(inner.extent, a, inner.wa, b[inner.vector]);
+      return;
+    }
+    auto const& loop = loops[l];
+    if(loop.chunk)
+      for(SizeType i = 0u; i < loop.extent; ++i, c += loop.wc, a += loop.wa)
+        self(self, l+1, c, a, w, std::min(SizeType(ttv_block), SizeType(inner.extent - i*SizeType(ttv_block))));
+    else if(is_free(loop))
+      for(SizeType i = 0u; i < loop.extent; ++i, c += loop.wc, a += loop.wa)
+        self(self, l+1, c, a, w, n);
+    else
+      for(SizeType i = 0u; i < loop.extent; ++i, a += loop.wa)
+        self(self, l+1, c, a, w * b[loop.vector][i], n);
+  };
+
+  // the outermost free loop writes disjoint parts of C and is split between threads
+  auto outer = std::find_if(loops.begin(), loops.end(), is_free);
+  if(outer == loops.end()){
+    lambda(lambda, 0u, c, a, w0, inner.extent);
+    return;
+  }
+  std::rotate(loops.begin(), outer, outer+1);
+
+  auto const& first = loops.front();
+  auto const extent = std::ptrdiff_t(first.extent);
+#pragma omp parallel for if (extent > 1 && size > ttv_parallel_size)
+  for(std::ptrdiff_t i = 0; i < extent; ++i){
+    auto const n = first.chunk ? std::min(SizeType(ttv_block), SizeType(inner.extent - SizeType(i)*SizeType(ttv_block))) : inner.extent;
+    lambda(lambda, 1u, c + SizeType(i)*first.wc, a + SizeType(i)*first.wa, w0, n);
+  }
+}
+
+} // namespace boost::numeric::ublas::detail
+
+
+#endif
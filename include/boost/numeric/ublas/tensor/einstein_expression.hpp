@@ -0,0 +1,563 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+
+#ifndef BOOST_UBLAS_TENSOR_EINSTEIN_EXPRESSION_HPP
+#define BOOST_UBLAS_TENSOR_EINSTEIN_EXPRESSION_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "extents.hpp"
+#include "index.hpp"
+#include "layout.hpp"
+#include "multiplication.hpp"
+#include "tensor.hpp"
+#include "type_traits.hpp"
+
+namespace boost::numeric::ublas
+{
+
+template<class ... operand_types>
+class einstein_expression;
+
+namespace detail
+{
+
+/** @brief Index ids of an operand of the einstein notation, e.g. {9,0,10} for A(_i,_,_j) */
+template<class tuple_type>
+struct einstein_ids;
+
+template<std::size_t ... I>
+struct einstein_ids<std::tuple<index::index_type<I>...>>
+{
+  static constexpr auto value = std::array<std::size_t,sizeof...(I)>{I...};
+};
+
+
+/** @brief Labels of the modes of an einstein chain with N operands and M modes
+ *
+ * Equal index ids of different operands share one label, index::_ gets a new label for each mode.
+ * Labels that appear in two operands are contracted, labels that appear once are free.
+ */
+template<std::size_t N, std::size_t M>
+struct einstein_labels
+{
+  std::array<std::size_t,N+1>   offset{}; // modes of operand k are offset[k],...,offset[k+1]-1
+  std::array<std::size_t,M>     label {}; // label of each mode
+  std::array<std::uint64_t,N>   mask  {}; // labels of each operand
+  std::uint64_t free   = 0;               // labels of the result
+  std::size_t   rank   = 0;               // number of free labels
+  bool          valid  = true;            // at most 64 labels, each in at most two operands and once per operand
+};
+
+template<class ... operand_types>
+constexpr auto make_einstein_labels()
+{
+  constexpr auto N = sizeof...(operand_types);
+  constexpr auto M = (std::tuple_size_v<typename operand_types::second_type> + ...);
+
+  auto l   = einstein_labels<N,M>{};
+  auto ids = std::array<std::size_t,M>{};
+  auto k   = std::size_t{0};
+  auto m   = std::size_t{0};
+  auto append = [&](auto const& operand_ids){
+    for(auto id : operand_ids)
+      ids[m++] = id;
+    l.offset[++k] = m;
+  };
+  (append(einstein_ids<typename operand_types::second_type>::value), ...);
+
+  auto count  = std::array<std::size_t,64>{};
+  auto labels = std::size_t{0};
+  for(k = 0; k < N; ++k){
+    for(m = l.offset[k]; m < l.offset[k+1]; ++m){
+      auto i = m;
+      if(ids[m] != 0)
+        i = std::size_t(std::find(ids.begin(), ids.begin()+m, ids[m]) - ids.begin());
+      if(i == m){
+        if(labels == count.size()){
+          l.valid = false;
+          return l;
+        }
+        l.label[m] = labels++;
+      }
+      else{
+        l.label[m] = l.label[i];
+        l.valid = l.valid && i < l.offset[k];
+      }
+      l.valid = l.valid && ++count[l.label[m]] <= 2;
+      l.mask[k] |= std::uint64_t{1} << l.label[m];
+    }
+  }
+  for(auto i = 0ul; i < labels; ++i){
+    if(count[i] == 1){
+      l.free |= std::uint64_t{1} << i;
+      ++l.rank;
+    }
+  }
+  return l;
+}
+
+
+/** @brief Collects the extent of each label and checks that contracted modes have equal extents
+ *
+ * @note can be evaluated at compile time if all extents are static
+*/
+template<std::size_t N, std::size_t M, class ... extents_types>
+constexpr auto make_einstein_extents(einstein_labels<N,M> const& l, extents_types const& ... na)
+{
+  auto n = std::array<double,64>{};
+  auto k = std::size_t{0};
+  auto collect = [&](auto const& e){
+    for(auto m = l.offset[k]; m < l.offset[k+1]; ++m){
+      auto const i  = l.label[m];
+      auto const ni = double(e[m-l.offset[k]]);
+      if(n[i] != 0 && n[i] != ni)
+        throw std::runtime_error("Error in boost::numeric::ublas::einstein_expression: extents of equal indices are not equal.");
+      n[i] = ni;
+    }
+    ++k;
+  };
+  (collect(na), ...);
+  return n;
+}
+
+
+/** @brief Number of elements spanned by the labels */
+constexpr double einstein_size(std::uint64_t labels, std::array<double,64> const& n)
+{
+  auto s = 1.0;
+  for(; labels != 0; labels &= labels-1)
+    s *= n[std::size_t(std::countr_zero(labels))];
+  return s;
+}
+
+/** @brief Cost of contracting two terms with the labels a and b
+ *
+ * Counts the multiply-adds over all labels of both terms plus the elements of the intermediate result.
+ * Labels in a and b are contracted since every label appears in at most two operands.
+*/
+constexpr double einstein_pair_cost(std::uint64_t a, std::uint64_t b, std::array<double,64> const& n)
+{
+  return einstein_size(a|b, n) + einstein_size(a^b, n);
+}
+
+
+/** @brief Order of the pairwise contractions of an einstein chain with N operands
+ *
+ * Operands are numbered 0,...,N-1, the intermediate result of steps[s] gets the number N+s.
+ * The last step computes the result.
+ */
+template<std::size_t N>
+struct einstein_plan
+{
+  std::array<std::array<std::size_t,2>,N-1> steps{};
+  double cost = 0;
+};
+
+/** @brief Chains with up to this number of operands are planned optimally, larger ones greedily */
+static constexpr std::size_t einstein_optimal_operands = 10;
+
+template<std::size_t N, std::size_t S>
+constexpr std::size_t einstein_emit(std::size_t set, std::array<std::size_t,S> const& split, einstein_plan<N>& plan, std::size_t& step)
+{
+  if((set & (set-1)) == 0)
+    return std::size_t(std::countr_zero(set));
+  auto const a = einstein_emit(split[set], split, plan, step);
+  auto const b = einstein_emit(set ^ split[set], split, plan, step);
+  plan.steps[step] = {a,b};
+  return N + step++;
+}
+
+/** @brief Computes the order of the pairwise contractions with the least einstein_pair_cost
+ *
+ * Searches all contraction trees over subsets of operands for chains with up to einstein_optimal_operands operands.
+ * Larger chains repeatedly contract the cheapest pair of terms that share an index.
+ *
+ * @note can be evaluated at compile time if all extents are static
+ *
+ * @param[in] mask labels of each operand
+ * @param[in] n    extent of each label
+*/
+template<std::size_t N>
+constexpr auto make_einstein_plan(std::array<std::uint64_t,N> const& mask, std::array<double,64> const& n)
+{
+  static_assert(N >= 2);
+
+  auto plan = einstein_plan<N>{};
+
+  if constexpr(N <= einstein_optimal_operands){
+    constexpr auto S = std::size_t{1} << N;
+    auto cost  = std::array<double,S>{};
+    auto split = std::array<std::size_t,S>{};
+    auto out   = std::array<std::uint64_t,S>{};
+    for(auto set = std::size_t{1}; set < S; ++set){
+      auto const low = set & (~set + 1);
+      if(set == low){
+        out[set] = mask[std::size_t(std::countr_zero(set))];
+        continue;
+      }
+      // contracted labels appear twice in the set and cancel
+      out [set] = out[low] ^ out[set^low];
+      cost[set] = std::numeric_limits<double>::max();
+      for(auto sub = (set-1) & set; sub != 0; sub = (sub-1) & set){
+        if((sub & low) == 0)
+          continue;
+        auto const c = cost[sub] + cost[set^sub] + einstein_pair_cost(out[sub], out[set^sub], n);
+        if(c < cost[set]){
+          cost [set] = c;
+          split[set] = sub;
+        }
+      }
+    }
+    auto step = std::size_t{0};
+    einstein_emit(S-1, split, plan, step);
+    plan.cost = cost[S-1];
+  }
+  else{
+    auto out  = std::array<std::uint64_t,2*N-1>{};
+    auto live = std::array<bool,2*N-1>{};
+    for(auto i = 0ul; i < N; ++i){
+      out [i] = mask[i];
+      live[i] = true;
+    }
+    for(auto s = 0ul; s < N-1; ++s){
+      auto best = std::numeric_limits<double>::max();
+      auto disjoint = true;
+      auto a = std::size_t{0}, b = std::size_t{0};
+      for(auto i = 0ul; i < N+s; ++i){
+        for(auto j = i+1; j < N+s && live[i]; ++j){
+          if(!live[j])
+            continue;
+          auto const d = (out[i] & out[j]) == 0;
+          auto const c = einstein_pair_cost(out[i], out[j], n);
+          if(d < disjoint || (d == disjoint && c < best)){
+            best = c;
+            disjoint = d;
+            a = i;
+            b = j;
+          }
+        }
+      }
+      plan.steps[s] = {a,b};
+      plan.cost += best;
+      live[a] = live[b] = false;
+      out [N+s] = out[a] ^ out[b];
+      live[N+s] = true;
+    }
+  }
+  return plan;
+}
+
+
+/** @brief Term of an einstein chain with its labels, extents and strides */
+template<class value_type>
+struct einstein_term
+{
+  value_type const* data = nullptr;
+  std::vector<std::size_t> label;
+  std::vector<std::size_t> n;
+  std::vector<std::size_t> w;
+};
+
+/** @brief Contracts the terms of an einstein chain in the order of the plan
+ *
+ * Each step calls ttt with the contraction method chosen by its cost. Intermediate results are stored
+ * in buffers that are reused as soon as their terms are consumed. The last step writes into c with the
+ * strides permuted such that the free modes appear in the order of the result.
+ *
+ * @param[in]  plan  order of the pairwise contractions
+ * @param[in]  term  operands in term[0],...,term[N-1]; the intermediate results are appended
+ * @param[out] c     pointer to the zero-initialized result
+ * @param[in]  wc    strides of the result for each label, only read for free labels
+ * @param[in]  first_order true if intermediate results are stored in the first-order layout
+*/
+template<std::size_t N, class value_type>
+void einstein_contract(einstein_plan<N> const& plan,
+                       std::array<einstein_term<value_type>,2*N-1>& term,
+                       value_type* c, std::array<std::size_t,64> const& wc,
+                       bool first_order)
+{
+  auto buffers = std::vector<std::vector<value_type>>{};
+  auto unused  = std::vector<std::size_t>{};
+  auto owner   = std::array<std::size_t,2*N-1>{};
+
+  for(auto s = 0ul; s < N-1; ++s){
+    auto const& a = term[plan.steps[s][0]];
+    auto const& b = term[plan.steps[s][1]];
+    auto const pa = a.label.size();
+    auto const pb = b.label.size();
+
+    auto& t = term[N+s];
+    auto phia = std::vector<std::size_t>{};
+    auto phib = std::vector<std::size_t>{};
+    auto position = [](auto const& labels, auto i){ return std::size_t(std::find(labels.begin(), labels.end(), i) - labels.begin()); };
+
+    for(auto i = 0ul; i < pa; ++i){
+      if(position(b.label, a.label[i]) == pb){
+        phia.push_back(i+1);
+        t.label.push_back(a.label[i]);
+        t.n.push_back(a.n[i]);
+      }
+    }
+    for(auto j = 0ul; j < pb; ++j){
+      if(position(a.label, b.label[j]) == pa){
+        phib.push_back(j+1);
+        t.label.push_back(b.label[j]);
+        t.n.push_back(b.n[j]);
+      }
+    }
+    auto const q = pa - phia.size();
+    for(auto i = 0ul; i < pa; ++i){
+      auto const j = position(b.label, a.label[i]);
+      if(j != pb){
+        phia.push_back(i+1);
+        phib.push_back(j+1);
+      }
+    }
+
+    // a scalar intermediate keeps one mode with extent 1 and a label that is not free
+    if(t.label.empty()){
+      t.label.push_back(wc.size()+s);
+      t.n.push_back(1);
+    }
+
+    auto const pc = t.label.size();
+    t.w.resize(pc);
+    auto* ct = c;
+    if(s == N-2){
+      for(auto i = 0ul; i < pc; ++i)
+        t.w[i] = t.label[i] < wc.size() ? wc[t.label[i]] : 1;
+    }
+    else{
+      auto size = std::size_t{1};
+      for(auto i = 0ul; i < pc; ++i){
+        auto const k = first_order ? i : pc-1-i;
+        t.w[k] = size;
+        size *= t.n[k];
+      }
+      if(unused.empty()){
+        owner[N+s] = buffers.size();
+        buffers.emplace_back(size);
+      }
+      else{
+        auto const largest = std::max_element(unused.begin(), unused.end(),
+          [&buffers](auto i, auto j){ return buffers[i].capacity() < buffers[j].capacity(); });
+        owner[N+s] = *largest;
+        unused.erase(largest);
+        buffers[owner[N+s]].assign(size, value_type{});
+      }
+      ct = buffers[owner[N+s]].data();
+    }
+    t.data = ct;
+
+    ttt(pa, pb, q, phia.data(), phib.data(),
+        ct, t.n.data(), t.w.data(),
+        a.data, a.n.data(), a.w.data(),
+        b.data, b.n.data(), b.w.data(),
+        contraction_method::automatic);
+
+    for(auto k : plan.steps[s])
+      if(k >= N)
+        unused.push_back(owner[k]);
+  }
+}
+
+
+/** @brief Result type of an einstein chain
+ *
+ * The free modes of the operands are ordered from left to right, padded with ones to at least two modes.
+ * The rank is dynamic if one of the operands has a dynamic rank.
+ */
+template<class ... operand_types>
+struct einstein_result
+{
+  using first_type   = std::decay_t<typename std::tuple_element_t<0,std::tuple<operand_types...>>::first_type>;
+  using value_type   = typename first_type::value_type;
+  using layout_type  = typename first_type::layout_type;
+
+  static constexpr auto labels  = make_einstein_labels<operand_types...>();
+  static constexpr auto dynamic = (is_dynamic_rank_v<typename std::decay_t<typename operand_types::first_type>::extents_type> || ...);
+  static constexpr auto static_extents = (is_static_v<typename std::decay_t<typename operand_types::first_type>::extents_type> && ...);
+
+  using extents_type = std::conditional_t<dynamic, extents<>, extents<std::max(labels.rank,std::size_t{2})>>;
+  using type         = tensor_core<tensor_engine<extents_type,layout_type,std::vector<value_type>>>;
+};
+
+/** @brief True for operands of the einstein notation and einstein expressions */
+template<class T>
+inline static constexpr bool is_einstein_operand_v = false;
+
+template<class T, class U>
+inline static constexpr bool is_einstein_operand_v<std::pair<T const&, U>> = true;
+
+template<class ... operand_types>
+inline static constexpr bool is_einstein_operand_v<einstein_expression<operand_types...>> = true;
+
+} // namespace detail
+
+
+
+/** @brief Lazy product of tensors in the einstein notation
+ *
+ * Captures a chain like A(_i,_j)*B(_j,_k)*C(_k,_l) and contracts the operands pairwise in the order with the
+ * least number of multiply-adds and intermediate elements, see detail::make_einstein_plan. The order is
+ * computed at compile time if all operands have static extents. Intermediate results share reused buffers.
+ *
+ * Indices that appear in two operands are contracted, the others are free and appear in the result from left
+ * to right. The result is computed when first accessed and is stored in the expression.
+ *
+ * @note operands are stored by reference and read on the first access. The expression must not outlive its
+ * operands, and the first access must not run concurrently with another access or with a write to an operand.
+ * Use the tensor type instead of auto if the value is meant.
+ *
+ * @code auto D = tensor_dynamic<float>( A(_i,_j)*B(_j,_k)*C(_k,_l) ); @endcode
+ *
+ * @tparam operand_types pairs of a tensor reference and a tuple of indices
+ */
+template<class ... operand_types>
+class einstein_expression
+{
+  static constexpr auto N = sizeof...(operand_types);
+  using result_type = detail::einstein_result<operand_types...>;
+
+  static_assert(N >= 2);
+  static_assert(result_type::labels.valid,
+                "Static error in boost::numeric::ublas::einstein_expression: an index must not appear in more than two operands or twice in one operand.");
+  static_assert((std::is_same_v<typename result_type::value_type, typename std::decay_t<typename operand_types::first_type>::value_type> && ...),
+                "Static error in boost::numeric::ublas::einstein_expression: operands must have the same value type.");
+
+public:
+  using tensor_type     = typename result_type::type;
+  using value_type      = typename tensor_type::value_type;
+  using size_type       = typename tensor_type::size_type;
+  using const_reference = typename tensor_type::const_reference;
+  using const_iterator  = typename tensor_type::const_iterator;
+  using extents_type    = typename tensor_type::extents_type;
+  using strides_type    = typename tensor_type::strides_type;
+  using operands_type   = std::tuple<operand_types...>;
+  using plan_type       = detail::einstein_plan<N>;
+
+  explicit einstein_expression(operands_type operands)
+    : _operands(std::move(operands))
+  {
+  }
+
+  [[nodiscard]] inline auto const& operands() const noexcept { return _operands; }
+
+  /** @brief Returns the order of the pairwise contractions */
+  [[nodiscard]] inline plan_type plan() const
+  {
+    if constexpr(result_type::static_extents){
+      return static_plan;
+    }
+    else{
+      auto const n = std::apply([](auto const& ... o){ return detail::make_einstein_extents(result_type::labels, o.first.extents() ...); }, _operands);
+      return detail::make_einstein_plan(result_type::labels.mask, n);
+    }
+  }
+
+  /** @brief Contracts the operands once and returns the result */
+  [[nodiscard]] tensor_type const& eval() const
+  {
+    if(!_result)
+      _result.emplace(evaluate());
+    return *_result;
+  }
+
+  inline operator tensor_type const& () const { return eval(); }
+
+  template<class ... is_types>
+  [[nodiscard]] inline const_reference at(size_type i, is_types ... is) const { return eval().at(i, is...); }
+  [[nodiscard]] inline const_reference operator[](size_type i) const { return eval()[i]; }
+
+  [[nodiscard]] inline auto  size   ()            const { return eval().size();  }
+  [[nodiscard]] inline auto  size   (size_type r) const { return eval().size(r); }
+  [[nodiscard]] inline auto  rank   ()            const { return eval().rank();  }
+  [[nodiscard]] inline auto  order  ()            const { return eval().order(); }
+  [[nodiscard]] inline bool  empty  ()            const { return eval().empty(); }
+  [[nodiscard]] inline auto const& extents()      const { return eval().extents(); }
+  [[nodiscard]] inline auto const& strides()      const { return eval().strides(); }
+  [[nodiscard]] inline auto  data   ()            const { return eval().data();  }
+  [[nodiscard]] inline auto  begin  ()            const { return eval().begin(); }
+  [[nodiscard]] inline auto  end    ()            const { return eval().end();   }
+  [[nodiscard]] inline auto  cbegin ()            const { return eval().cbegin();}
+  [[nodiscard]] inline auto  cend   ()            const { return eval().cend();  }
+
+private:
+  static constexpr auto static_plan = []{
+    if constexpr(result_type::static_extents)
+      return detail::make_einstein_plan(result_type::labels.mask,
+        detail::make_einstein_extents(result_type::labels, typename std::decay_t<typename operand_types::first_type>::extents_type{} ...));
+    else
+      return plan_type{};
+  }();
+
+  tensor_type evaluate() const
+  {
+    auto const& l = result_type::labels;
+    auto const plan = this->plan();
+
+    auto term = std::array<detail::einstein_term<value_type>,2*N-1>{};
+    auto nc   = typename extents_type::base_type{};
+    if constexpr(result_type::dynamic)
+      nc.resize(std::max(l.rank, std::size_t{2}));
+    std::fill(nc.begin(), nc.end(), std::size_t{1});
+
+    auto k = std::size_t{0};
+    auto r = std::size_t{0};
+    auto position = std::array<std::size_t,64>{};
+    auto collect = [&](auto const& operand){
+      auto const& a = operand.first;
+      auto& t = term[k];
+      t.data  = a.data();
+      for(auto m = l.offset[k]; m < l.offset[k+1]; ++m){
+        auto const i = l.label[m];
+        auto const j = m - l.offset[k];
+        t.label.push_back(i);
+        t.n.push_back(a.extents()[j]);
+        t.w.push_back(a.strides()[j]);
+        if((l.free >> i) & 1u){
+          position[i] = r;
+          nc[r++] = a.extents()[j];
+        }
+      }
+      ++k;
+    };
+    std::apply([&collect](auto const& ... o){ (collect(o), ...); }, _operands);
+
+    auto c = tensor_type(extents_type(nc), std::vector<value_type>(product(extents_type(nc)), value_type{}));
+
+    auto wc = std::array<std::size_t,64>{};
+    for(auto i = 0ul; i < wc.size(); ++i)
+      if((l.free >> i) & 1u)
+        wc[i] = c.strides()[position[i]];
+
+    detail::einstein_contract(plan, term, c.data(), wc, std::is_same_v<typename result_type::layout_type, layout::first_order>);
+    return c;
+  }
+
+  operands_type _operands;
+  mutable std::optional<tensor_type> _result;
+};
+
+} // namespace boost::numeric::ublas
+
+#endif // BOOST_UBLAS_TENSOR_EINSTEIN_EXPRESSION_HPP
@@ -11,9 +11,13 @@
 #ifndef BOOST_NUMERIC_UBLAS_TENSOR_TTM_HPP
 #define BOOST_NUMERIC_UBLAS_TENSOR_TTM_HPP
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <numeric>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "../extents.hpp"
 #include "../type_traits.hpp"
@@ -102,6 +106,116 @@ inline decltype(auto) prod( tensor_core< TE > const &a, matrix<T,L,A> const &b,
   return c;
 }
 
+/** @brief Computes a chain of m-mode tensor-times-matrix products
+ *
+ * Implements C = A x_m1 B1 x_m2 B2 ... x_mk Bk with
+ * C[i1,...,j1,...,jk,...,ip] = sum(A[i1,...,ip] * B1[j1,im1] * ... * Bk[jk,imk])
+ * or with Bx[imx,jx] if the matrices are transposed.
+ *
+ * The products are computed in the order with the least number of multiply-adds which also shrinks
+ * the intermediate tensors as early as possible. Mode m is multiplied before mode n if
+ * (J_m-I_m)/(I_m*J_m) < (J_n-I_n)/(I_n*J_n) where I and J are the extents of the contracted and the new mode.
+ * The intermediate tensors alternate between two workspace buffers and the last product is written to C.
+ *
+ * @note calls ublas::ttm
+ *
+ * @param[in] a tensor object A with order p
+ * @param[in] b matrices B1,...,Bk with the value type and layout of A
+ * @param[in] modes distinct contraction dimensions with 1 <= mx <= p, one for each matrix
+ * @param[in] transposed multiplies with the transposed matrices if true
+ *
+ * @returns tensor object C with order p, the same storage format and allocator type as A
+*/
+template <typename TE,
+          typename M = typename tensor_core<TE>::matrix_type,
+          detail::enable_ttm_if_extent_is_modifiable<TE> = true >
+inline decltype(auto) multi_ttm(tensor_core< TE > const &a,
+                                std::vector<M> const& b,
+                                std::vector<std::size_t> const& modes,
+                                bool const transposed = false)
+{
+  using tensor_type    = tensor_core< TE >;
+  using extents_type   = typename tensor_type::extents_type;
+  using layout_type    = typename tensor_type::layout_type;
+  using value_type     = typename tensor_type::value_type;
+  using resizeable_tag = typename tensor_type::resizable_tag;
+
+  static_assert(std::is_same_v<resizeable_tag, storage_resizable_container_tag> );
+  static_assert(is_dynamic_v<extents_type>);
+  static_assert(std::is_same_v<typename M::value_type, value_type> && std::is_same_v<typename M::orientation_category, typename layout_type::orientation_category>,
+                "Static error in boost::numeric::ublas::multi_ttm: matrices must have the value type and layout of the tensor.");
+
+  auto const   p = a.rank();
+  auto const& na = a.extents();
+
+  if( b.size() != modes.size() ) throw std::length_error("Error in boost::numeric::ublas::multi_ttm: number of matrices and contraction modes must be equal.");
+  if( b.empty() )                throw std::length_error("Error in boost::numeric::ublas::multi_ttm: at least one matrix must be given.");
+
+  auto const rows = [&b,transposed](std::size_t k){ return std::size_t(transposed ? b[k].size2() : b[k].size1()); };
+  auto const cols = [&b,transposed](std::size_t k){ return std::size_t(transposed ? b[k].size1() : b[k].size2()); };
+
+  auto used = std::vector<bool>(p, false);
+  for(auto k = 0ul; k < b.size(); ++k){
+    auto const m = modes[k];
+    if( m == 0 )             throw std::length_error("Error in boost::numeric::ublas::multi_ttm: contraction mode must be greater than zero.");
+    if( p <  m )             throw std::length_error("Error in boost::numeric::ublas::multi_ttm: tensor order must be greater than or equal to the specified mode.");
+    if( used[m-1] )          throw std::invalid_argument("Error in boost::numeric::ublas::multi_ttm: contraction modes must be distinct.");
+    if( na[m-1] != cols(k) ) throw std::invalid_argument("Error in boost::numeric::ublas::multi_ttm: 2nd extent of B and m-th extent of A must be equal.");
+    used[m-1] = true;
+  }
+
+  // J/I is the growth of the tensor and I*J the cost per element
+  auto const key = [&rows,&cols](std::size_t k){ return (double(rows(k))-double(cols(k))) / (double(rows(k))*double(cols(k))); };
+  auto order = std::vector<std::size_t>(b.size());
+  std::iota(order.begin(), order.end(), 0ul);
+  std::stable_sort(order.begin(), order.end(), [&key](std::size_t l, std::size_t r){ return key(l) < key(r); });
+
+  // extents of the intermediate tensors, the even steps are stored in the first buffer
+  auto steps = std::vector<extents_type>{};
+  auto sizes = std::array<std::size_t,2>{0ul,0ul};
+  auto nc_base = na.base();
+  for(auto s = 0ul; s < order.size(); ++s){
+    auto const k = order[s];
+    nc_base[modes[k]-1] = rows(k);
+    steps.emplace_back(nc_base);
+    if(s+1 < order.size())
+      sizes[s%2] = std::max(sizes[s%2], ublas::product(steps.back()));
+  }
+
+  auto buffers = std::array<std::vector<value_type>,2>{std::vector<value_type>(sizes[0]), std::vector<value_type>(sizes[1])};
+  auto c = tensor_type(steps.back());
+
+  value_type const* in = a.data();
+  auto const* nin = na.data();
+  auto win = a.strides();
+  for(auto s = 0ul; s < order.size(); ++s){
+    auto const  k  = order[s];
+    auto const  m  = modes[k];
+    auto const& nc = steps[s];
+    auto const  wc = ublas::to_strides(nc,layout_type{});
+    auto* out = s+1 < order.size() ? buffers[s%2].data() : c.data();
+    std::fill(out, out + ublas::product(nc), value_type{});
+
+    auto nb = extents<2>{std::size_t(b[k].size1()), std::size_t(b[k].size2())};
+    auto wb = ublas::to_strides(nb,layout_type{});
+    if(transposed){
+      nb = extents<2>{nb[1], nb[0]};
+      wb = decltype(wb){wb[1], wb[0]};
+    }
+
+    ttm(m, p,
+        out, nc.data(),  wc.data(),
+        in,  nin,        win.data(),
+        &(b[k](0, 0)), nb.data(), wb.data());
+
+    in  = out;
+    nin = nc.data();
+    win = wc;
+  }
+
+  return c;
+}
+
 
 /** @brief Computes the m-mode tensor-times-matrix product
      *
@@ -15,6 +15,7 @@
 #include <stdexcept>
 #include <type_traits>
 
+#include "../contraction.hpp"
 #include "../extents.hpp"
 #include "../tags.hpp"
 #include "../tensor.hpp"
@@ -61,7 +62,7 @@ using enable_ttt_if_one_extents_has_dynamic_rank = std::enable_if_t<
      *
      * Implements C[i1,...,ir,j1,...,js] = sum( A[i1,...,ir+q] * B[j1,...,js+q]  )
      *
-     * @note calls ublas::ttt
+     * @note calls ublas::ttt which chooses between the scalar recursion and GEMM-based contractions
      *
      * na[phia[x]] = nb[phib[x]] for 1 <= x <= q
      *
@@ -157,7 +158,8 @@ inline decltype(auto) prod(tensor_core< TEA > const &a,
       phia1.data(), phib1.data(),
       c.data(), c.extents().data(), c.strides().data(),
       a.data(), a.extents().data(), a.strides().data(),
-      b.data(), b.extents().data(), b.strides().data());
+      b.data(), b.extents().data(), b.strides().data(),
+      contraction_method::automatic);
 
   return c;
 }
@@ -212,7 +214,7 @@ using enable_ttt_if_extents_have_static_rank = std::enable_if_t<
      *
      * Implements C[i1,...,ir,j1,...,js] = sum( A[i1,...,ir+q] * B[j1,...,js+q]  )
      *
-     * @note calls ublas::ttt
+     * @note calls ublas::ttt which chooses between the scalar recursion and GEMM-based contractions
      *
      * na[phia[x]] = nb[phib[x]] for 1 <= x <= q
      *
@@ -300,7 +302,8 @@ inline auto prod(tensor_core<TEA> const &a,
       phia1.data(), phib1.data(),
       c.data(), c.extents().data(), c.strides().data(),
       a.data(), a.extents().data(), a.strides().data(),
-      b.data(), b.extents().data(), b.strides().data());
+      b.data(), b.extents().data(), b.strides().data(),
+      contraction_method::automatic);
 
   return c;
 }
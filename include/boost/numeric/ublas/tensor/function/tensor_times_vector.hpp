@@ -11,9 +11,11 @@
 #ifndef BOOST_NUMERIC_UBLAS_TENSOR_TTV_HPP
 #define BOOST_NUMERIC_UBLAS_TENSOR_TTV_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "../extents.hpp"
 #include "../type_traits.hpp"
@@ -106,6 +108,66 @@ inline decltype(auto) prod( tensor_core< TE > const &a, vector<T, A> const &b, c
 }
 
 
+/** @brief Computes the tensor-times-vector products with several vectors in one pass
+     *
+     * Implements C[i1,...,ip without im1,...,imq] = A[i1,i2,...,ip] * b1[im1] * ... * bq[imq]
+     *
+     * @note calls ublas::multi_ttv
+     *
+     * @param[in] a tensor object A with order p
+     * @param[in] b vector objects b1,...,bq
+     * @param[in] modes distinct contraction dimensions with 1 <= mk <= p, one for each vector
+     *
+     * @returns tensor object C with order max(p-q,2), the same storage format and allocator type as A
+    */
+template <class TE, class V = typename tensor_core< TE >::vector_type,
+          detail::enable_ttv_if_extent_has_dynamic_rank<TE> = true >
+inline decltype(auto) multi_ttv( tensor_core< TE > const &a, std::vector<V> const &b, std::vector<std::size_t> const& modes)
+{
+
+  using tensor            = tensor_core< TE >;
+  using shape             = typename tensor::extents_type;
+  using value             = typename tensor::value_type;
+  using resize_tag        = typename tensor::resizable_tag;
+
+  auto const p = a.rank();
+  auto const q = modes.size();
+
+  static_assert(std::is_same_v<resize_tag,storage_resizable_container_tag>);
+  static_assert(is_dynamic_v<shape>);
+
+  if (b.size() != q) throw std::length_error("error in boost::numeric::ublas::multi_ttv: number of vectors and contraction modes must be equal.");
+  if (q == 0ul)      throw std::length_error("error in boost::numeric::ublas::multi_ttv: at least one vector must be given.");
+  if (p < q)         throw std::length_error("error in boost::numeric::ublas::multi_ttv: rank of tensor must be greater than or equal to the number of contraction modes.");
+  if (a.empty())     throw std::length_error("error in boost::numeric::ublas::multi_ttv: first argument tensor should not be empty.");
+
+  auto const& na = a.extents();
+  auto contracted = std::vector<bool>(p, false);
+  auto bb = std::vector<value const*>(q);
+  for (auto k = 0ul; k < q; ++k){
+    if (modes[k] == 0ul || p < modes[k]) throw std::length_error("error in boost::numeric::ublas::multi_ttv: contraction mode must be greater than zero and less than or equal to the rank of tensor.");
+    if (contracted[modes[k]-1])          throw std::length_error("error in boost::numeric::ublas::multi_ttv: contraction modes must be distinct.");
+    if (b[k].size() != na[modes[k]-1])   throw std::length_error("error in boost::numeric::ublas::multi_ttv: size of vector must be equal to the extent of its contraction mode.");
+    contracted[modes[k]-1] = true;
+    bb[k] = &(b[k](0));
+  }
+
+  auto const sz = std::max( std::size_t(p-q), std::size_t(2) );
+  auto nc_base = typename shape::base_type(sz,1);
+
+  for (auto i = 0ul, j = 0ul; i < p; ++i)
+    if (!contracted[i])
+      nc_base[j++] = na.at(i);
+
+  auto c = tensor( shape(nc_base), value{} );
+  multi_ttv(q, modes.data(), p,
+            c.data(), c.extents().data(), c.strides().data(),
+            a.data(), a.extents().data(), a.strides().data(),
+            bb.data());
+  return c;
+}
+
+
 namespace detail {
 /** Enables if extent E is dynamic with static rank: extents<N> */
 template<
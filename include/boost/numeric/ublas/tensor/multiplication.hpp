@@ -15,6 +15,8 @@
 
 #include <cassert>
 
+#include "contraction.hpp"
+
 namespace boost::numeric::ublas {
 namespace detail::recursive {
 
@@ -597,13 +599,62 @@ void outer(SizeType const k,
 
 namespace boost::numeric::ublas {
 
+namespace detail {
+
+/** @brief Checks the arguments of the tensor-times-tensor product with permutation tuples
+ *
+ * @note is used in function ttt
+*/
+template <class PointerIn1, class PointerIn2, class PointerOut, class SizeType>
+void check_ttt(SizeType const pa, SizeType const pb, SizeType const q,
+               SizeType const*const phia, SizeType const*const phib,
+               PointerOut c, SizeType const*const nc,
+               PointerIn1 a, SizeType const*const na,
+               PointerIn2 b, SizeType const*const nb)
+{
+  if( pa == 0 || pb == 0){
+    throw std::length_error("Error in boost::numeric::ublas::ttt: tensor order must be greater zero.");
+  }
+
+  if( q > pa && q > pb) {
+    throw std::length_error("Error in boost::numeric::ublas::ttt: number of contraction must be smaller than or equal to the tensor order.");
+  }
+
+  SizeType const r = pa - q;
+  SizeType const s = pb - q;
+
+  if(c == nullptr || a == nullptr || b == nullptr){
+    throw std::length_error("Error in boost::numeric::ublas::ttm: Pointers shall not be null pointers.");
+  }
+  for(auto i = 0ul; i < r; ++i){
+    if( na[phia[i]-1] != nc[i] ){
+      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of lhs and res tensor not correct.");
+    }
+  }
+  for(auto i = 0ul; i < s; ++i){
+    if( nb[phib[i]-1] != nc[r+i] ){
+      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of rhs and res not correct.");
+    }
+  }
+  for(auto i = 0ul; i < q; ++i){
+    if( nb[phib[s+i]-1] != na[phia[r+i]-1] ){
+      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of lhs and rhs not correct.");
+    }
+  }
+}
+
+} // namespace detail
+
 /** @brief Computes the tensor-times-vector product
  *
  * Implements
  *   C[i1,i2,...,im-1,im+1,...,ip] = sum(A[i1,i2,...,im,...,ip] * b[im]) for m>1 and
  *   C[i2,...,ip]                  = sum(A[i1,...,ip]           * b[i1]) for m=1
  *
- * @note calls detail::ttv, detail::ttv0 or detail::mtv
+ * @note calls detail::fused_ttv or detail::inner
+ *
+ * For a contiguous mode m the elements of C are dot products over contiguous sequences of A.
+ * Otherwise contiguous slabs of A are scaled with the elements of b and added to C.
  *
  * @param[in]  m  contraction mode with 0 < m <= p
  * @param[in]  p  number of dimensions (rank) of the first input tensor with p > 0
@@ -657,14 +708,8 @@ void ttv(SizeType const m, SizeType const p,
   }
 
 
-  if((m != 1) && (p > 2)){
-    detail::recursive::ttv(m-1, p-1, p-2, c, nc, wc,    a, na, wa,   b);
-  }
-  else if ((m == 1) && (p > 2)){
-    detail::recursive::ttv0(p-1, c, nc, wc,  a, na, wa,   b);
-  }
-  else if( p == 2 ){
-    detail::recursive::mtv(m-1, c, nc, wc,  a, na, wa,   b);
+  if( p > 1 ){
+    detail::fused_ttv(SizeType(1), &m, p, c, wc,  a, na, wa,  &b);
   }
   else /*if( p == 1 )*/{
     auto v = std::remove_pointer_t<std::remove_cv_t<PointerOut>>{};
@@ -674,6 +719,68 @@ void ttv(SizeType const m, SizeType const p,
 }
 
 
+/** @brief Computes the tensor-times-vector products with several vectors in one pass
+ *
+ * Implements C[i1,...,ip without im1,...,imq] = sum(A[i1,...,ip] * b1[im1] * ... * bq[imq])
+ *
+ * The modes of C are the modes of A that are not contracted, in the same order.
+ * C is not overwritten but the products are added to it.
+ *
+ * @note calls detail::fused_ttv
+ *
+ * @param[in]  q     number of contraction modes with 0 < q <= p
+ * @param[in]  modes pointer to the q distinct contraction modes with 0 < modes[k] <= p
+ * @param[in]  p     number of dimensions (rank) of the input tensor with p > 0
+ * @param[out] c     pointer to the output tensor with rank max(p-q,2)
+ * @param[in]  nc    pointer to the extents of tensor c
+ * @param[in]  wc    pointer to the strides of tensor c
+ * @param[in]  a     pointer to the input tensor
+ * @param[in]  na    pointer to the extents of input tensor a
+ * @param[in]  wa    pointer to the strides of input tensor a
+ * @param[in]  b     pointer to q pointers to contiguous vectors, b[k] with na[modes[k]-1] elements
+*/
+template <class PointerOut, class PointerIn1, class PointerIn2, class SizeType>
+void multi_ttv(SizeType const q, SizeType const*const modes, SizeType const p,
+               PointerOut c,       SizeType const*const nc, SizeType const*const wc,
+               const PointerIn1 a, SizeType const*const na, SizeType const*const wa,
+               PointerIn2 const*const b)
+{
+  static_assert( std::is_pointer<PointerOut>::value && std::is_pointer<PointerIn1>::value & std::is_pointer<PointerIn2>::value,
+                "Static error in boost::numeric::ublas::multi_ttv: Argument types for pointers are not pointer types.");
+
+  if( p == 0){
+    throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Rank must be greater than zero.");
+  }
+  if( q == 0 || p < q ){
+    throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Number of contraction modes must be greater than zero and less equal the rank.");
+  }
+  if(c == nullptr || a == nullptr || b == nullptr){
+    throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Pointers shall not be null pointers.");
+  }
+
+  auto contracted = std::vector<bool>(p, false);
+  for(auto k = 0u; k < q; ++k){
+    if( modes[k] == 0 || p < modes[k] ){
+      throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Contraction mode must be greater than zero and less equal the rank.");
+    }
+    if( contracted[modes[k]-1] ){
+      throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Contraction modes must be distinct.");
+    }
+    if( b[k] == nullptr ){
+      throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Pointers shall not be null pointers.");
+    }
+    contracted[modes[k]-1] = true;
+  }
+  for(auto i = 0u, j = 0u; i < p; ++i){
+    if( !contracted[i] && na[i] != nc[j++] ){
+      throw std::length_error("Error in boost::numeric::ublas::multi_ttv: Extents of the free modes of A and C must be equal.");
+    }
+  }
+
+  detail::fused_ttv(q, modes, p, c, wc,  a, na, wa,  b);
+}
+
+
 
 /** @brief Computes the tensor-times-matrix product
  *
@@ -681,7 +788,10 @@ void ttv(SizeType const m, SizeType const p,
  *   C[i1,i2,...,im-1,j,im+1,...,ip] = sum(A[i1,i2,...,im,...,ip] * B[j,im]) for m>1 and
  *   C[j,i2,...,ip]                  = sum(A[i1,i2,...,ip]        * B[j,i1]) for m=1
  *
- * @note calls detail::ttm or detail::ttm0
+ * @note calls detail::loop_over_gemm, detail::ttm or detail::ttm0
+ *
+ * Large products are mapped onto strided GEMMs with detail::make_ttm_plan: a single GEMM for m=1 and
+ * first-order storage, otherwise GEMMs batched over the outer modes and run in parallel over the batches.
  *
  * @param[in]  m  contraction mode with 0 < m <= p
  * @param[in]  p  number of dimensions (rank) of the first input tensor with p > 0
@@ -738,7 +848,11 @@ void ttm(SizeType const m, SizeType const p,
   }
 
 
-  if ( m != 1 ){
+  auto const plan = detail::make_ttm_plan(m, p, wc, na, wa, nb, wb);
+  if(detail::loop_over_gemm_cost(plan) < detail::recursive_cost(plan.batches*double(plan.m.extent), double(nb[0]), double(nb[1]))){
+    detail::loop_over_gemm(plan, c, a, b);
+  }
+  else if ( m != 1 ){
     detail::recursive::ttm (m-1, p-1, c, nc, wc,    a, na, wa,   b, nb, wb);
   }
   else{ /*if (m == 1 && p >  2)*/
@@ -783,35 +897,11 @@ void ttt(SizeType const pa, SizeType const pb, SizeType const q,
   static_assert( std::is_pointer<PointerOut>::value && std::is_pointer<PointerIn1>::value && std::is_pointer<PointerIn2>::value,
                 "Static error in boost::numeric::ublas::ttm: Argument types for pointers are not pointer types.");
 
-  if( pa == 0 || pb == 0){
-    throw std::length_error("Error in boost::numeric::ublas::ttt: tensor order must be greater zero.");
-  }
-
-  if( q > pa && q > pb) {
-    throw std::length_error("Error in boost::numeric::ublas::ttt: number of contraction must be smaller than or equal to the tensor order.");
-  }
+  detail::check_ttt(pa,pb,q, phia,phib, c,nc, a,na, b,nb);
 
   SizeType const r = pa - q;
   SizeType const s = pb - q;
 
-  if(c == nullptr || a == nullptr || b == nullptr){
-    throw std::length_error("Error in boost::numeric::ublas::ttm: Pointers shall not be null pointers.");
-  }
-  for(auto i = 0ul; i < r; ++i){
-    if( na[phia[i]-1] != nc[i] ){
-      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of lhs and res tensor not correct.");
-    }
-  }
-  for(auto i = 0ul; i < s; ++i){
-    if( nb[phib[i]-1] != nc[r+i] ){
-      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of rhs and res not correct.");
-    }
-  }
-  for(auto i = 0ul; i < q; ++i){
-    if( nb[phib[s+i]-1] != na[phia[r+i]-1] ){
-      throw std::length_error("Error in boost::numeric::ublas::ttt: dimensions of lhs and rhs not correct.");
-    }
-  }
   if(q == 0ul){
     detail::recursive::outer(SizeType{0},r,s,  phia,phib, c,nc,wc, a,na,wa, b,nb,wb);
   }
@@ -900,6 +990,73 @@ void ttt(SizeType const pa, SizeType const pb, SizeType const q,
 }
 
 
+/** @brief Computes the tensor-times-tensor product with the given contraction method
+ *
+ * Implements C[i1,...,ir,j1,...,js] += sum( A[i1,...,ir+q] * B[j1,...,js+q]  )
+ *
+ * @note calls ttt, detail::loop_over_gemm or detail::ttgt
+ *
+ * loop_over_gemm multiplies the largest matrix-like mode groups of A, B and C with strided GEMMs
+ * and loops over the remaining modes. ttgt copies the operands whose modes are not matrix-like
+ * into contiguous buffers and computes a single GEMM. automatic chooses the method with the
+ * least estimated cost, which is the scalar recursion for small tensors.
+ *
+ * nc[x]         = na[phia[x]  ] for 1 <= x <= r
+ * nc[r+x]       = nb[phib[x]  ] for 1 <= x <= s
+ * na[phia[r+x]] = nb[phib[s+x]] for 1 <= x <= q
+ *
+ * @param[in]  pa number of dimensions (rank) of the first input tensor a with pa > 0
+ * @param[in]  pb number of dimensions (rank) of the second input tensor b with pb > 0
+ * @param[in]  q  number of contraction dimensions with pa >= q and pb >= q and q >= 0
+ * @param[in]  phia pointer to a permutation tuple for the first input tensor a
+ * @param[in]  phib pointer to a permutation tuple for the second input tensor b
+ * @param[out] c  pointer to the output tensor with rank p-1
+ * @param[in]  nc pointer to the extents of tensor c
+ * @param[in]  wc pointer to the strides of tensor c
+ * @param[in]  a  pointer to the first input tensor
+ * @param[in]  na pointer to the extents of input tensor a
+ * @param[in]  wa pointer to the strides of input tensor a
+ * @param[in]  b  pointer to the second input tensor
+ * @param[in]  nb pointer to the extents of input tensor b
+ * @param[in]  wb pointer to the strides of input tensor b
+ * @param[in]  method contraction method
+*/
+template <class PointerIn1, class PointerIn2, class PointerOut, class SizeType>
+void ttt(SizeType const pa, SizeType const pb, SizeType const q,
+         SizeType const*const phia, SizeType const*const phib,
+         PointerOut c, SizeType const*const nc, SizeType const*const wc,
+         PointerIn1 a, SizeType const*const na, SizeType const*const wa,
+         PointerIn2 b, SizeType const*const nb, SizeType const*const wb,
+         contraction_method method)
+{
+  static_assert( std::is_pointer<PointerOut>::value && std::is_pointer<PointerIn1>::value && std::is_pointer<PointerIn2>::value,
+                "Static error in boost::numeric::ublas::ttt: Argument types for pointers are not pointer types.");
+
+  if(q == 0u || method == contraction_method::recursive){
+    ttt(pa,pb,q, phia,phib, c,nc,wc, a,na,wa, b,nb,wb);
+    return;
+  }
+
+  detail::check_ttt(pa,pb,q, phia,phib, c,nc, a,na, b,nb);
+
+  SizeType const r = pa - q;
+  SizeType const s = pb - q;
+
+  auto const modes = detail::make_contraction_modes(r,s,q, phia,phib, nc,wc, na,wa, wb);
+
+  if(method == contraction_method::automatic)
+    method = detail::choose_contraction_method(modes);
+
+  if(method == contraction_method::recursive)
+    ttt(pa,pb,q, phia,phib, c,nc,wc, a,na,wa, b,nb,wb);
+  else if(method == contraction_method::loop_over_gemm)
+    detail::loop_over_gemm(detail::make_loop_over_gemm_plan(modes), c, a, b);
+  else
+    detail::ttgt(detail::make_ttgt_plan(modes), pa, pb, SizeType(r+s), c,nc,wc, a,na,wa, b,nb,wb);
+}
+
+
+
 /** @brief Computes the inner product of two tensors
  *
  * Implements c = sum(A[i1,i2,...,ip] * B[i1,i2,...,ip])
@@ -14,6 +14,7 @@
 
 #include "expression.hpp"
 #include "expression_evaluation.hpp"
+#include "einstein_expression.hpp"
 #include "multi_index_utility.hpp"
 #include "functions.hpp"
 #include "type_traits.hpp"
@@ -452,6 +453,15 @@ inline constexpr
 
 /** @brief Performs a tensor contraction, not an elementwise multiplication
     *
+    * Operands without a common index form an outer product. Unless both operands have the same indices,
+    * the product is a lazy einstein_expression that can be multiplied with further operands before the
+    * contraction order is chosen.
+    *
+    * @note the einstein_expression refers to its operands and computes the result on first access,
+    * not at its construction. Writing to an operand before the first access changes the result, and
+    * an expression with a temporary operand must not outlive the full-expression. Its first access is
+    * not thread-safe. Spell out the tensor type if a value is meant:
+    * @code tensor_dynamic<float> C = A(_i,_j)*B(_j,_k); @endcode
 */
 
 template<class tensor_type_left, class tuple_type_left, class tensor_type_right, class tuple_type_right>
@@ -462,47 +472,95 @@ auto operator*(
 
   namespace ublas = boost::numeric::ublas;
 
-  auto const& tensor_left  = lhs.first;
-  auto const& tensor_right = rhs.first;
-
-  auto multi_index_left  = lhs.second;
-  auto multi_index_right = rhs.second;
-
   static constexpr auto num_equal_ind = ublas::number_equal_indexes<tuple_type_left, tuple_type_right>::value;
 
-  if constexpr ( num_equal_ind == 0  ){
-    return tensor_left * tensor_right;
-  }
-  else if constexpr ( num_equal_ind==std::tuple_size<tuple_type_left>::value && std::is_same<tuple_type_left, tuple_type_right>::value ){
+  if constexpr ( num_equal_ind != 0 && num_equal_ind==std::tuple_size<tuple_type_left>::value && std::is_same<tuple_type_left, tuple_type_right>::value ){
 
-    return ublas::inner_prod( tensor_left, tensor_right );
+    return ublas::inner_prod( lhs.first, rhs.first );
   }
   else {
-    auto index_pairs = ublas::index_position_pairs(multi_index_left,multi_index_right);
-    constexpr auto size = std::tuple_size_v<decltype(index_pairs)>;
-
-    using extents_left_type  = typename tensor_type_left ::extents_type;
-    using extents_right_type = typename tensor_type_right::extents_type;
-
-    constexpr bool has_dynamic_extents = ublas::is_dynamic_rank_v<extents_left_type> || ublas::is_dynamic_rank_v<extents_right_type>;
-
-    using index_tuple = std::conditional_t<has_dynamic_extents, std::vector<std::size_t>, std::array<std::size_t, size>>;
-
-    auto phi_left  = index_tuple{};
-    auto phi_right = index_tuple{};
-
-    if constexpr(has_dynamic_extents) {
-      phi_left .resize(size);
-      phi_right.resize(size);
-    }
+    return ublas::einstein_expression<decltype(lhs),decltype(rhs)>( std::make_tuple(lhs, rhs) );
+  }
 
-    std::transform(index_pairs.begin(), index_pairs.end(), phi_left .begin(), [](auto a){ return a.first  +1ul; } );
-    std::transform(index_pairs.begin(), index_pairs.end(), phi_right.begin(), [](auto b){ return b.second +1ul; } );
+}
 
-//    auto index_pairs = ublas::array_to_vector(  array_index_pairs  );
-    return ublas::prod( tensor_left, tensor_right, phi_left, phi_right );
-  }
+/** @brief Appends a tensor to a lazy product in the einstein notation
+    *
+*/
+template<class ... operand_types, class tensor_type, class tuple_type>
+auto operator*(
+  boost::numeric::ublas::einstein_expression<operand_types...> const& lhs,
+  std::pair< tensor_type const&, tuple_type > rhs)
+{
+  using rhs_type = std::pair< tensor_type const&, tuple_type >;
+  return boost::numeric::ublas::einstein_expression<operand_types...,rhs_type>( std::tuple_cat(lhs.operands(), std::make_tuple(rhs)) );
+}
 
+template<class tensor_type, class tuple_type, class ... operand_types>
+auto operator*(
+  std::pair< tensor_type const&, tuple_type > lhs,
+  boost::numeric::ublas::einstein_expression<operand_types...> const& rhs)
+{
+  using lhs_type = std::pair< tensor_type const&, tuple_type >;
+  return boost::numeric::ublas::einstein_expression<lhs_type,operand_types...>( std::tuple_cat(std::make_tuple(lhs), rhs.operands()) );
 }
 
+template<class ... operand_types_left, class ... operand_types_right>
+auto operator*(
+  boost::numeric::ublas::einstein_expression<operand_types_left ...> const& lhs,
+  boost::numeric::ublas::einstein_expression<operand_types_right...> const& rhs)
+{
+  return boost::numeric::ublas::einstein_expression<operand_types_left...,operand_types_right...>( std::tuple_cat(lhs.operands(), rhs.operands()) );
+}
+
+
+// Overloaded Arithmetic Operators with the result of an einstein_expression
+template<class ... operand_types, class R>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<R>)
+inline auto operator*(boost::numeric::ublas::einstein_expression<operand_types...> const& lhs, R const& rhs) { return lhs.eval() * rhs; }
+template<class ... operand_types, class R>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<R>)
+inline auto operator+(boost::numeric::ublas::einstein_expression<operand_types...> const& lhs, R const& rhs) { return lhs.eval() + rhs; }
+template<class ... operand_types, class R>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<R>)
+inline auto operator-(boost::numeric::ublas::einstein_expression<operand_types...> const& lhs, R const& rhs) { return lhs.eval() - rhs; }
+template<class ... operand_types, class R>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<R>)
+inline auto operator/(boost::numeric::ublas::einstein_expression<operand_types...> const& lhs, R const& rhs) { return lhs.eval() / rhs; }
+
+template<class L, class ... operand_types>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<L>)
+inline auto operator*(L const& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs * rhs.eval(); }
+template<class L, class ... operand_types>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<L>)
+inline auto operator+(L const& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs + rhs.eval(); }
+template<class L, class ... operand_types>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<L>)
+inline auto operator-(L const& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs - rhs.eval(); }
+template<class L, class ... operand_types>
+  requires (!boost::numeric::ublas::detail::is_einstein_operand_v<L>)
+inline auto operator/(L const& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs / rhs.eval(); }
+
+template<class ... operand_types_left, class ... operand_types_right>
+inline auto operator+(boost::numeric::ublas::einstein_expression<operand_types_left ...> const& lhs,
+                      boost::numeric::ublas::einstein_expression<operand_types_right...> const& rhs) { return lhs.eval() + rhs.eval(); }
+template<class ... operand_types_left, class ... operand_types_right>
+inline auto operator-(boost::numeric::ublas::einstein_expression<operand_types_left ...> const& lhs,
+                      boost::numeric::ublas::einstein_expression<operand_types_right...> const& rhs) { return lhs.eval() - rhs.eval(); }
+template<class ... operand_types_left, class ... operand_types_right>
+inline auto operator/(boost::numeric::ublas::einstein_expression<operand_types_left ...> const& lhs,
+                      boost::numeric::ublas::einstein_expression<operand_types_right...> const& rhs) { return lhs.eval() / rhs.eval(); }
+
+template<class ... operand_types>
+inline auto operator-(boost::numeric::ublas::einstein_expression<operand_types...> const& e) { return -e.eval(); }
+
+template<class T, class ... operand_types>
+inline auto& operator += (boost::numeric::ublas::tensor_core<T>& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs += rhs.eval(); }
+template<class T, class ... operand_types>
+inline auto& operator -= (boost::numeric::ublas::tensor_core<T>& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs -= rhs.eval(); }
+template<class T, class ... operand_types>
+inline auto& operator *= (boost::numeric::ublas::tensor_core<T>& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs *= rhs.eval(); }
+template<class T, class ... operand_types>
+inline auto& operator /= (boost::numeric::ublas::tensor_core<T>& lhs, boost::numeric::ublas::einstein_expression<operand_types...> const& rhs) { return lhs /= rhs.eval(); }
+
 #endif
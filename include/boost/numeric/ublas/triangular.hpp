@@ -15,6 +15,7 @@
 
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/detail/temporary.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
 #include <boost/type_traits/remove_const.hpp>
 
 // Iterators based on ideas of Jeremy Siek
@@ -2541,33 +2542,63 @@ namespace boost { namespace numeric { namespace ublas {
     //  k * n * (n - 1) / 2 + k * n = k * n * (n + 1) / 2 multiplications,
     //  k * n * (n - 1) / 2 additions
 
-    // Dense (proxy) case
-    template<class E1, class E2>
-    BOOST_UBLAS_INLINE
-    void inplace_solve (const matrix_expression<E1> &e1, matrix_expression<E2> &e2,
-                        lower_tag, dense_proxy_tag) {
-        typedef typename E2::size_type size_type;
-        typedef typename E2::value_type value_type;
+    namespace detail {
 
-        BOOST_UBLAS_CHECK (e1 ().size1 () == e1 ().size2 (), bad_size ());
-        BOOST_UBLAS_CHECK (e1 ().size2 () == e2 ().size1 (), bad_size ());
-        size_type size1 = e2 ().size1 ();
-        size_type size2 = e2 ().size2 ();
-        for (size_type n = 0; n < size1; ++ n) {
+        // Blocked: the rows are split into diagonal blocks solved by the scalar
+        // kernel, the rows below each block are updated by a matrix product.
+        // Blocks of right hand side columns are independent and solved in parallel.
+        template<class M1, class M2>
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void block_solve (const M1 &a, M2 &b, lower_tag) {
+            typedef typename M2::size_type size_type;
+            typedef typename M2::value_type value_type;
+
+            BOOST_UBLAS_CHECK (a.size1 () == a.size2 (), bad_size ());
+            BOOST_UBLAS_CHECK (a.size2 () == b.size1 (), bad_size ());
+            size_type size1 = b.size1 ();
+            size_type size2 = b.size2 ();
+            for (size_type n = 0; n < size1; ++ n) {
 #ifndef BOOST_UBLAS_SINGULAR_CHECK
-            BOOST_UBLAS_CHECK (e1 () (n, n) != value_type/*zero*/(), singular ());
+                BOOST_UBLAS_CHECK (a (n, n) != value_type/*zero*/(), singular ());
 #else
-            if (e1 () (n, n) == value_type/*zero*/())
-                singular ().raise ();
-#endif
-            for (size_type l = 0; l < size2; ++ l) {
-                value_type t = e2 () (n, l) /= e1 () (n, n);
-                if (t != value_type/*zero*/()) {
-                    for (size_type m = n + 1; m < size1; ++ m)
-                        e2 () (m, l) -= e1 () (m, n) * t;
+                if (a (n, n) == value_type/*zero*/())
+                    singular ().raise ();
+#endif
+            }
+            const size_type block = kernel_block_m;
+            const size_type column_blocks = (size2 + block - 1) / block;
+#pragma omp parallel for if (column_blocks > 1 && double (size1) * size1 * size2 > double (kernel_parallel_work))
+            for (size_type cb = 0; cb < column_blocks; ++ cb) {
+                const size_type l0 = cb * block, l1 = (std::min) (size2, size_type (l0 + block));
+                for (size_type k0 = 0; k0 < size1; k0 += block) {
+                    const size_type k1 = (std::min) (size1, size_type (k0 + block));
+                    for (size_type n = k0; n < k1; ++ n) {
+                        for (size_type l = l0; l < l1; ++ l) {
+                            value_type t = b (n, l) /= a (n, n);
+                            if (t != value_type/*zero*/()) {
+                                for (size_type m = n + 1; m < k1; ++ m)
+                                    b (m, l) -= a (m, n) * t;
+                            }
+                        }
+                    }
+                    if (k1 < size1) {
+                        typename sub_block<M2>::type b_below (sub_block<M2>::apply (b, k1, size1, l0, l1));
+                        block_gemm (b_below, value_type (-1),
+                                    sub_block<const M1>::apply (a, k1, size1, k0, k1),
+                                    sub_block<M2>::apply (b, k0, k1, l0, l1));
+                    }
                 }
             }
         }
+
+    }
+
+    // Dense (proxy) case
+    template<class E1, class E2>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const matrix_expression<E1> &e1, matrix_expression<E2> &e2,
+                        lower_tag, dense_proxy_tag) {
+        detail::block_solve (e1 (), e2 (), lower_tag ());
     }
     // Packed (proxy) case
     template<class E1, class E2>
@@ -2649,34 +2680,62 @@ namespace boost { namespace numeric { namespace ublas {
                        unit_lower_tag (), dispatch_category ());
     }
 
-    // Dense (proxy) case
-    template<class E1, class E2>
-    BOOST_UBLAS_INLINE
-    void inplace_solve (const matrix_expression<E1> &e1, matrix_expression<E2> &e2,
-                        upper_tag, dense_proxy_tag) {
-        typedef typename E2::size_type size_type;
-        typedef typename E2::difference_type difference_type;
-        typedef typename E2::value_type value_type;
+    namespace detail {
 
-        BOOST_UBLAS_CHECK (e1 ().size1 () == e1 ().size2 (), bad_size ());
-        BOOST_UBLAS_CHECK (e1 ().size2 () == e2 ().size1 (), bad_size ());
-        size_type size1 = e2 ().size1 ();
-        size_type size2 = e2 ().size2 ();
-        for (difference_type n = size1 - 1; n >= 0; -- n) {
+        // Blocked like the lower triangular case, from the last diagonal block upwards.
+        template<class M1, class M2>
+        // BOOST_UBLAS_INLINE This function seems to be big. So we do not let the compiler inline it.
+        void block_solve (const M1 &a, M2 &b, upper_tag) {
+            typedef typename M2::size_type size_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef typename M2::value_type value_type;
+
+            BOOST_UBLAS_CHECK (a.size1 () == a.size2 (), bad_size ());
+            BOOST_UBLAS_CHECK (a.size2 () == b.size1 (), bad_size ());
+            size_type size1 = b.size1 ();
+            size_type size2 = b.size2 ();
+            for (difference_type n = size1 - 1; n >= 0; -- n) {
 #ifndef BOOST_UBLAS_SINGULAR_CHECK
-            BOOST_UBLAS_CHECK (e1 () (n, n) != value_type/*zero*/(), singular ());
+                BOOST_UBLAS_CHECK (a (n, n) != value_type/*zero*/(), singular ());
 #else
-            if (e1 () (n, n) == value_type/*zero*/())
-                singular ().raise ();
-#endif
-            for (difference_type l = size2 - 1; l >= 0; -- l) {
-                value_type t = e2 () (n, l) /= e1 () (n, n);
-                if (t != value_type/*zero*/()) {
-                    for (difference_type m = n - 1; m >= 0; -- m)
-                        e2 () (m, l) -= e1 () (m, n) * t;
+                if (a (n, n) == value_type/*zero*/())
+                    singular ().raise ();
+#endif
+            }
+            const size_type block = kernel_block_m;
+            const size_type column_blocks = (size2 + block - 1) / block;
+#pragma omp parallel for if (column_blocks > 1 && double (size1) * size1 * size2 > double (kernel_parallel_work))
+            for (size_type cb = 0; cb < column_blocks; ++ cb) {
+                const size_type l0 = cb * block, l1 = (std::min) (size2, size_type (l0 + block));
+                for (size_type k1 = size1; k1 > 0; k1 -= (std::min) (k1, block)) {
+                    const size_type k0 = k1 - (std::min) (k1, block);
+                    for (difference_type n = k1 - 1; n >= difference_type (k0); -- n) {
+                        for (size_type l = l0; l < l1; ++ l) {
+                            value_type t = b (n, l) /= a (n, n);
+                            if (t != value_type/*zero*/()) {
+                                for (difference_type m = n - 1; m >= difference_type (k0); -- m)
+                                    b (m, l) -= a (m, n) * t;
+                            }
+                        }
+                    }
+                    if (k0 > 0) {
+                        typename sub_block<M2>::type b_above (sub_block<M2>::apply (b, 0, k0, l0, l1));
+                        block_gemm (b_above, value_type (-1),
+                                    sub_block<const M1>::apply (a, 0, k0, k0, k1),
+                                    sub_block<M2>::apply (b, k0, k1, l0, l1));
+                    }
                 }
             }
         }
+
+    }
+
+    // Dense (proxy) case
+    template<class E1, class E2>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const matrix_expression<E1> &e1, matrix_expression<E2> &e2,
+                        upper_tag, dense_proxy_tag) {
+        detail::block_solve (e1 (), e2 (), upper_tag ());
     }
     // Packed (proxy) case
     template<class E1, class E2>
@@ -2759,6 +2818,70 @@ namespace boost { namespace numeric { namespace ublas {
                        unit_upper_tag (), dispatch_category ());
     }
 
+    namespace detail {
+
+        // Solves with the dense blocks of a triangle in rectangular full packed storage
+        template<class T, class M>
+        void rfp_solve (const rfp_blocks<T> &r, M &b, lower_tag) {
+            typedef typename M::value_type value_type;
+
+            BOOST_UBLAS_CHECK (r.l11.size1 () + r.l22.size1 () == b.size1 (), bad_size ());
+            typename sub_block<M>::type b1 (sub_block<M>::apply (b, 0, r.split, 0, b.size2 ()));
+            typename sub_block<M>::type b2 (sub_block<M>::apply (b, r.split, b.size1 (), 0, b.size2 ()));
+            block_solve (r.l11, b1, lower_tag ());
+            block_gemm (b2, value_type (-1), r.l21, b1);
+            block_solve (r.l22, b2, lower_tag ());
+        }
+        template<class T, class M>
+        void rfp_solve (const rfp_blocks<T> &r, M &b, upper_tag) {
+            typedef typename M::value_type value_type;
+
+            BOOST_UBLAS_CHECK (r.l11.size1 () + r.l22.size1 () == b.size1 (), bad_size ());
+            typename sub_block<M>::type b1 (sub_block<M>::apply (b, 0, r.split, 0, b.size2 ()));
+            typename sub_block<M>::type b2 (sub_block<M>::apply (b, r.split, b.size1 (), 0, b.size2 ()));
+            block_solve (r.l22.transpose (), b2, upper_tag ());
+            block_gemm (b1, value_type (-1), r.l21.transpose (), b2);
+            block_solve (r.l11.transpose (), b1, upper_tag ());
+        }
+
+        template<class T, class TRI, class L, class A, class E, class C>
+        void rfp_solve (const triangular_matrix<T, TRI, L, A> &m, E &e, C) {
+            BOOST_UBLAS_CHECK (m.size1 () == e.size1 (), bad_size ());
+            if (m.size1 () == 0)
+                return;
+            rfp_solve (rfp_blocks<const T> (&m.data () [0], m.size1 (), rfp_lower_columns<TRI, L> ()), e, C ());
+        }
+
+    }
+
+    // Rectangular full packed case
+    // The triangle is split into two triangles and a full block, all dense blocks
+    // of the packed rectangle, solved and updated by the dense blocked kernels.
+    template<class T, class Z, class Z1, class D1, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const triangular_matrix<T, basic_lower<Z>, basic_rfp_column_major<Z1, D1>, A> &m,
+                        matrix_expression<E> &e, lower_tag) {
+        detail::rfp_solve (m, e (), lower_tag ());
+    }
+    template<class T, class Z, class Z1, class D1, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const triangular_matrix<T, basic_lower<Z>, basic_rfp_row_major<Z1, D1>, A> &m,
+                        matrix_expression<E> &e, lower_tag) {
+        detail::rfp_solve (m, e (), lower_tag ());
+    }
+    template<class T, class Z, class Z1, class D1, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const triangular_matrix<T, basic_upper<Z>, basic_rfp_column_major<Z1, D1>, A> &m,
+                        matrix_expression<E> &e, upper_tag) {
+        detail::rfp_solve (m, e (), upper_tag ());
+    }
+    template<class T, class Z, class Z1, class D1, class A, class E>
+    BOOST_UBLAS_INLINE
+    void inplace_solve (const triangular_matrix<T, basic_upper<Z>, basic_rfp_row_major<Z1, D1>, A> &m,
+                        matrix_expression<E> &e, upper_tag) {
+        detail::rfp_solve (m, e (), upper_tag ());
+    }
+
     template<class E1, class E2, class C>
     BOOST_UBLAS_INLINE
     typename matrix_matrix_solve_traits<E1, E2>::result_type
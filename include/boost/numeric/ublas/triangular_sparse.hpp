@@ -0,0 +1,284 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_TRIANGULAR_SPARSE_
+#define _BOOST_UBLAS_TRIANGULAR_SPARSE_
+
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+// Triangular solves on compressed (CSR) factors using level scheduling.
+// The analysis phase groups the rows into levels whose rows only depend on
+// rows of earlier levels; the solve phase then processes each level in parallel.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    /** \brief Dependency levels of a sparse triangular system.
+     *
+     * The schedule is computed once from the sparsity pattern of a row major
+     * compressed_matrix and can be reused for any number of right hand sides,
+     * as well as after the values (but not the pattern) of the matrix changed.
+     * Only the triangle selected by \c TRI is considered, so the strict lower
+     * and upper parts of an in-place LU factor can be solved with the same matrix.
+     *
+     * \tparam M row major compressed_matrix type
+     * \tparam TRI one of \c lower_tag, \c unit_lower_tag, \c upper_tag or \c unit_upper_tag
+     */
+    template<class M, class TRI>
+    class level_schedule {
+    public:
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef unbounded_array<size_type> index_array_type;
+        typedef unbounded_array<array_size_type> ptr_array_type;
+        typedef TRI triangular_type;
+
+        BOOST_STATIC_ASSERT ((boost::is_same<typename M::orientation_category, row_major_tag>::value));
+
+        // Construction and destruction
+        explicit
+        level_schedule (const M &m):
+            size_ (m.size1 ()), nnz_ (m.nnz ()),
+            first_data_ (size_), last_data_ (size_), diagonal_data_ (size_),
+            level_ptr_ (1, array_size_type (0)), level_data_ (size_) {
+            BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+            analyse_rows (m, triangular_type ());
+            compute_levels (m, triangular_type ());
+        }
+
+        // Accessors
+        BOOST_UBLAS_INLINE
+        size_type size () const {
+            return size_;
+        }
+        BOOST_UBLAS_INLINE
+        array_size_type nnz () const {
+            return nnz_;
+        }
+        BOOST_UBLAS_INLINE
+        size_type levels () const {
+            return level_ptr_.size () - 1;
+        }
+
+        // Storage accessors
+        // rows ordered by level, level l occupies [level_ptr () [l], level_ptr () [l + 1])
+        BOOST_UBLAS_INLINE
+        const ptr_array_type &level_ptr () const {
+            return level_ptr_;
+        }
+        BOOST_UBLAS_INLINE
+        const index_array_type &level_data () const {
+            return level_data_;
+        }
+        // off diagonal entries of row i occupy [first_data () [i], last_data () [i]) of the matrix arrays
+        BOOST_UBLAS_INLINE
+        const ptr_array_type &first_data () const {
+            return first_data_;
+        }
+        BOOST_UBLAS_INLINE
+        const ptr_array_type &last_data () const {
+            return last_data_;
+        }
+        // position of the diagonal entry of row i, unused for unit triangular systems
+        BOOST_UBLAS_INLINE
+        const ptr_array_type &diagonal_data () const {
+            return diagonal_data_;
+        }
+
+        BOOST_UBLAS_INLINE
+        static bool is_unit () {
+            return boost::is_same<triangular_type, unit_lower_tag>::value ||
+                   boost::is_same<triangular_type, unit_upper_tag>::value;
+        }
+
+    private:
+        void analyse_rows (const M &m, lower_tag) {
+            const size_type ib = M::index_base ();
+            for (size_type i = 0; i < size_; ++ i) {
+                array_size_type begin, end;
+                row_range (m, i, begin, end);
+                array_size_type k = begin;
+                while (k < end && m.index2_data () [k] - ib < i)
+                    ++ k;
+                first_data_ [i] = begin;
+                last_data_ [i] = k;
+                check_diagonal (m, i, k, end);
+            }
+        }
+        void analyse_rows (const M &m, upper_tag) {
+            const size_type ib = M::index_base ();
+            for (size_type i = 0; i < size_; ++ i) {
+                array_size_type begin, end;
+                row_range (m, i, begin, end);
+                array_size_type k = begin;
+                while (k < end && m.index2_data () [k] - ib < i)
+                    ++ k;
+                check_diagonal (m, i, k, end);
+                if (k < end && m.index2_data () [k] - ib == i)
+                    ++ k;
+                first_data_ [i] = k;
+                last_data_ [i] = end;
+            }
+        }
+        void row_range (const M &m, size_type i, array_size_type &begin, array_size_type &end) const {
+            const size_type ib = M::index_base ();
+            if (i + 1 < m.filled1 ()) {
+                begin = m.index1_data () [i] - ib;
+                end = m.index1_data () [i + 1] - ib;
+            } else {
+                begin = end = m.nnz ();
+            }
+        }
+        void check_diagonal (const M &m, size_type i, array_size_type k, array_size_type end) {
+            if (k < end && m.index2_data () [k] - M::index_base () == i) {
+                diagonal_data_ [i] = k;
+            } else {
+                diagonal_data_ [i] = nnz_;
+                if (! is_unit ())
+                    singular ().raise ();
+            }
+        }
+
+        void compute_levels (const M &m, lower_tag) {
+            sort_by_level (m, 0, size_type (1));
+        }
+        void compute_levels (const M &m, upper_tag) {
+            sort_by_level (m, size_ - 1, size_type (-1));
+        }
+
+        // Assign each row one level above its highest dependency, then
+        // bucket the rows by level keeping the row order inside a level
+        void sort_by_level (const M &m, size_type start, size_type step) {
+            const size_type ib = M::index_base ();
+            index_array_type level (size_, size_type (0));
+            size_type n_levels = 0;
+            for (size_type n = 0, i = start; n < size_; ++ n, i += step) {
+                size_type l = 0;
+                for (array_size_type k = first_data_ [i]; k < last_data_ [i]; ++ k)
+                    l = (std::max) (l, level [m.index2_data () [k] - ib] + 1);
+                level [i] = l;
+                n_levels = (std::max) (n_levels, l + 1);
+            }
+            level_ptr_.resize (n_levels + 1);
+            std::fill (level_ptr_.begin (), level_ptr_.end (), array_size_type (0));
+            for (size_type i = 0; i < size_; ++ i)
+                ++ level_ptr_ [level [i] + 1];
+            for (size_type l = 0; l < n_levels; ++ l)
+                level_ptr_ [l + 1] += level_ptr_ [l];
+            ptr_array_type next (n_levels);
+            std::copy (level_ptr_.begin (), level_ptr_.begin () + n_levels, next.begin ());
+            for (size_type n = 0, i = start; n < size_; ++ n, i += step)
+                level_data_ [next [level [i]] ++] = i;
+        }
+
+        size_type size_;
+        array_size_type nnz_;
+        ptr_array_type first_data_;
+        ptr_array_type last_data_;
+        ptr_array_type diagonal_data_;
+        ptr_array_type level_ptr_;
+        index_array_type level_data_;
+    };
+
+    namespace detail {
+
+        // Minimum number of row updates for a level to be processed in parallel.
+        // Smaller levels, common near the ends of the schedule, do not pay for a fork/join.
+        static const std::size_t level_parallel_work = 256;
+
+        // Non unit solves divide by every diagonal element
+        template<class M, class TRI>
+        void check_level_diagonal (const M &m, const level_schedule<M, TRI> &s) {
+            ignore_unused_variable_warning (m);
+            ignore_unused_variable_warning (s);
+#if BOOST_UBLAS_CHECK_ENABLE || defined (BOOST_UBLAS_SINGULAR_CHECK)
+            typedef typename M::size_type size_type;
+            typedef typename M::value_type value_type;
+
+            if (s.is_unit ())
+                return;
+            for (size_type i = 0; i < s.size (); ++ i) {
+#ifndef BOOST_UBLAS_SINGULAR_CHECK
+                BOOST_UBLAS_CHECK (m.value_data () [s.diagonal_data () [i]] != value_type/*zero*/(), singular ());
+#else
+                if (m.value_data () [s.diagonal_data () [i]] == value_type/*zero*/())
+                    singular ().raise ();
+#endif
+            }
+#endif
+        }
+
+    }
+
+    // Level scheduled solve of m * x = e, overwriting e with x.
+    // Rows of one level are independent, large levels are processed in parallel.
+    template<class M, class TRI, class E>
+    void inplace_solve (const M &m, vector_expression<E> &e, const level_schedule<M, TRI> &s) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == s.size () && m.nnz () == s.nnz (), bad_size ());
+        BOOST_UBLAS_CHECK (e ().size () == s.size (), bad_size ());
+        detail::check_level_diagonal (m, s);
+        const size_type ib = M::index_base ();
+        const bool unit = s.is_unit ();
+        for (size_type l = 0; l < s.levels (); ++ l) {
+#pragma omp parallel for if (s.level_ptr () [l + 1] - s.level_ptr () [l] >= detail::level_parallel_work)
+            for (array_size_type p = s.level_ptr () [l]; p < s.level_ptr () [l + 1]; ++ p) {
+                const size_type i = s.level_data () [p];
+                value_type t = e () (i);
+                for (array_size_type k = s.first_data () [i]; k < s.last_data () [i]; ++ k)
+                    t -= m.value_data () [k] * e () (m.index2_data () [k] - ib);
+                if (! unit)
+                    t /= m.value_data () [s.diagonal_data () [i]];
+                e () (i) = t;
+            }
+        }
+    }
+
+    // Level scheduled solve of m * X = e for all columns of e at once.
+    // Every sparse row is read once per level sweep, whatever the number of right hand sides.
+    template<class M, class TRI, class E>
+    void inplace_solve (const M &m, matrix_expression<E> &e, const level_schedule<M, TRI> &s) {
+        typedef typename M::size_type size_type;
+        typedef typename M::array_size_type array_size_type;
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (m.size1 () == s.size () && m.nnz () == s.nnz (), bad_size ());
+        BOOST_UBLAS_CHECK (e ().size1 () == s.size (), bad_size ());
+        detail::check_level_diagonal (m, s);
+        const size_type ib = M::index_base ();
+        const size_type size2 = e ().size2 ();
+        const bool unit = s.is_unit ();
+        for (size_type l = 0; l < s.levels (); ++ l) {
+#pragma omp parallel for if (double (s.level_ptr () [l + 1] - s.level_ptr () [l]) * size2 >= double (detail::level_parallel_work))
+            for (array_size_type p = s.level_ptr () [l]; p < s.level_ptr () [l + 1]; ++ p) {
+                const size_type i = s.level_data () [p];
+                for (array_size_type k = s.first_data () [i]; k < s.last_data () [i]; ++ k) {
+                    const value_type a = m.value_data () [k];
+                    const size_type j = m.index2_data () [k] - ib;
+                    for (size_type c = 0; c < size2; ++ c)
+                        e () (i, c) -= a * e () (j, c);
+                }
+                if (! unit) {
+                    const value_type d = m.value_data () [s.diagonal_data () [i]];
+                    for (size_type c = 0; c < size2; ++ c)
+                        e () (i, c) /= d;
+                }
+            }
+        }
+    }
+
+}}}
+
+#endif
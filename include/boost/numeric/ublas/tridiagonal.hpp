@@ -0,0 +1,309 @@
+//
+//  Copyright (c) 2026
+//  The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef _BOOST_UBLAS_TRIDIAGONAL_
+#define _BOOST_UBLAS_TRIDIAGONAL_
+
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/detail/block_kernels.hpp>
+
+#include <limits>
+
+// Direct solvers for tridiagonal systems A x = b. A is given by its three
+// diagonals as in LAPACK's GTSV: dl (i) = A (i + 1, i) and du (i) = A (i, i + 1)
+// for i < n - 1, d (i) = A (i, i), or as a banded_matrix with one lower and one
+// upper band. None of the solvers pivot, so A should be diagonally dominant or
+// symmetric positive definite; use banded_lu_factorize otherwise.
+
+namespace boost { namespace numeric { namespace ublas {
+
+    namespace detail {
+
+        // LU factors of a tridiagonal matrix without pivoting: A = L U with unit
+        // lower L of multipliers m (i) = L (i, i - 1) and upper U of pivots
+        // w (i) = U (i, i) and the super diagonal du.
+        template<class V1, class V2, class V3, class W>
+        std::size_t tridiagonal_factorize (const V1 &dl, const V2 &d, const V3 &du, W &w, W &m) {
+            typedef std::size_t size_type;
+            typedef typename W::value_type value_type;
+
+            const size_type size = d.size ();
+            for (size_type i = 0; i < size; ++ i) {
+                if (i == 0) {
+                    w [0] = d (0);
+                } else {
+                    m [i] = dl (i - 1) / w [i - 1];
+                    w [i] = d (i) - m [i] * du (i - 1);
+                }
+                if (w [i] == value_type/*zero*/())
+                    return i + 1;
+            }
+            return 0;
+        }
+
+        // x = inverse (L U) x for one right hand side
+        template<class V3, class W, class V>
+        void tridiagonal_substitute (const V3 &du, const W &w, const W &m, V &x) {
+            typedef std::size_t size_type;
+
+            const size_type size = x.size ();
+            if (size == 0)
+                return;
+            for (size_type i = 1; i < size; ++ i)
+                x (i) -= m [i] * x (i - 1);
+            x (size - 1) /= w [size - 1];
+            for (size_type i = size - 1; i > 0; -- i)
+                x (i - 1) = (x (i - 1) - du (i - 1) * x (i)) / w [i - 1];
+        }
+
+        // x = inverse (L U) x for the columns of x, swept row by row so that
+        // the inner loop runs along the rows. Blocks of columns run in parallel.
+        template<class V3, class W, class M>
+        void tridiagonal_substitute_columns (const V3 &du, const W &w, const W &m, M &x) {
+            typedef std::size_t size_type;
+
+            const size_type size = x.size1 (), size2 = x.size2 ();
+            if (size == 0)
+                return;
+            const size_type blocks = (size2 + kernel_block_m - 1) / kernel_block_m;
+#pragma omp parallel for if (double (size) * size2 > double (kernel_parallel_work))
+            for (size_type block = 0; block < blocks; ++ block) {
+                const size_type c0 = block * kernel_block_m, c1 = (std::min) (size2, size_type (c0 + kernel_block_m));
+                for (size_type i = 1; i < size; ++ i)
+                    for (size_type c = c0; c < c1; ++ c)
+                        x (i, c) -= m [i] * x (i - 1, c);
+                for (size_type c = c0; c < c1; ++ c)
+                    x (size - 1, c) /= w [size - 1];
+                for (size_type i = size - 1; i > 0; -- i)
+                    for (size_type c = c0; c < c1; ++ c)
+                        x (i - 1, c) = (x (i - 1, c) - du (i - 1) * x (i, c)) / w [i - 1];
+            }
+        }
+
+    }
+
+    /** \brief Solves the tridiagonal system A x = b with the Thomas algorithm.
+     *
+     * \c e holds b on entry and x on return. Takes O(n) operations.
+     *
+     * \return 0 if no pivot vanished, else one plus the index of the first zero
+     * pivot, \c e being left unchanged.
+     */
+    template<class E1, class E2, class E3, class E>
+    std::size_t tridiagonal_solve (const vector_expression<E1> &dl, const vector_expression<E2> &d,
+                                   const vector_expression<E3> &du, vector_expression<E> &e) {
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (d ().size () == 0 || (dl ().size () + 1 == d ().size () && du ().size () + 1 == d ().size ()), bad_size ());
+        BOOST_UBLAS_CHECK (e ().size () == d ().size (), bad_size ());
+        unbounded_array<value_type> w (d ().size ()), m (d ().size ());
+        const std::size_t singular = detail::tridiagonal_factorize (dl (), d (), du (), w, m);
+        if (singular == 0)
+            detail::tridiagonal_substitute (du (), w, m, e ());
+        return singular;
+    }
+    /** \brief Solves the tridiagonal system A X = B for the columns of \c e.
+     *
+     * A is factorized once. The columns are swept together along the rows of
+     * \c e, in parallel by blocks of 64 columns.
+     */
+    template<class E1, class E2, class E3, class E>
+    std::size_t tridiagonal_solve (const vector_expression<E1> &dl, const vector_expression<E2> &d,
+                                   const vector_expression<E3> &du, matrix_expression<E> &e) {
+        typedef typename E::value_type value_type;
+
+        BOOST_UBLAS_CHECK (d ().size () == 0 || (dl ().size () + 1 == d ().size () && du ().size () + 1 == d ().size ()), bad_size ());
+        BOOST_UBLAS_CHECK (e ().size1 () == d ().size (), bad_size ());
+        unbounded_array<value_type> w (d ().size ()), m (d ().size ());
+        const std::size_t singular = detail::tridiagonal_factorize (dl (), d (), du (), w, m);
+        if (singular == 0)
+            detail::tridiagonal_substitute_columns (du (), w, m, e ());
+        return singular;
+    }
+
+    namespace detail {
+
+        template<class T, class L, class A, class E>
+        std::size_t banded_tridiagonal_solve (const banded_matrix<T, L, A> &m, E &e) {
+            typedef matrix_vector_range<const banded_matrix<T, L, A> > diagonal_type;
+
+            BOOST_UBLAS_CHECK (m.size1 () == m.size2 (), bad_size ());
+            BOOST_UBLAS_CHECK (m.lower () <= 1 && m.upper () <= 1, bad_argument ());
+            const std::size_t size = m.size1 ();
+            if (size == 0)
+                return 0;
+            const diagonal_type dl (m, range (1, size), range (0, size - 1));
+            const diagonal_type d (m, range (0, size), range (0, size));
+            const diagonal_type du (m, range (0, size - 1), range (1, size));
+            return tridiagonal_solve (dl, d, du, e);
+        }
+
+    }
+
+    /** \brief Solves A x = b for a banded_matrix A with at most one lower and one upper band.
+     *
+     * Same as tridiagonal_solve (dl, d, du, e) on the diagonals of \c m.
+     */
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    std::size_t tridiagonal_solve (const banded_matrix<T, L, A> &m, vector_expression<E> &e) {
+        return detail::banded_tridiagonal_solve (m, e);
+    }
+    template<class T, class L, class A, class E>
+    BOOST_UBLAS_INLINE
+    std::size_t tridiagonal_solve (const banded_matrix<T, L, A> &m, matrix_expression<E> &e) {
+        return detail::banded_tridiagonal_solve (m, e);
+    }
+
+    /** \brief Solves the tridiagonal system A x = b by parallel cyclic reduction.
+     *
+     * Every reduction step combines each equation with its neighbours at
+     * distance 1, 2, 4, ... and is fully parallel. After ceil (log2 (n)) steps
+     * the equations are decoupled. Takes O(n log n) operations instead of the
+     * O(n) of tridiagonal_solve, for n / log (n) times the parallelism; use it
+     * for large single systems on many cores.
+     *
+     * \c x holds b on entry and x on return.
+     *
+     * \return 0 on success, else one plus the index of the first equation whose
+     * reduced diagonal element is zero or not finite.
+     */
+    template<class E1, class E2, class E3, class E>
+    std::size_t cyclic_reduction_solve (const vector_expression<E1> &dl, const vector_expression<E2> &d,
+                                        const vector_expression<E3> &du, vector_expression<E> &x) {
+        typedef std::size_t size_type;
+        typedef typename E::value_type value_type;
+        typedef typename type_traits<value_type>::real_type real_type;
+
+        const size_type size = d ().size ();
+        BOOST_UBLAS_CHECK (dl ().size () + 1 == size || size == 0, bad_size ());
+        BOOST_UBLAS_CHECK (du ().size () + 1 == size || size == 0, bad_size ());
+        BOOST_UBLAS_CHECK (x ().size () == size, bad_size ());
+        // a: sub diagonal, b: diagonal, c: super diagonal, r: right hand side
+        unbounded_array<value_type> a (size), b (size), c (size), r (size);
+        unbounded_array<value_type> a2 (size), b2 (size), c2 (size), r2 (size);
+        for (size_type i = 0; i < size; ++ i) {
+            a [i] = i > 0 ? value_type (dl () (i - 1)) : value_type/*zero*/();
+            b [i] = d () (i);
+            c [i] = i + 1 < size ? value_type (du () (i)) : value_type/*zero*/();
+            r [i] = x () (i);
+        }
+        for (size_type s = 1; s < size; s *= 2) {
+#pragma omp parallel for if (size > size_type (detail::kernel_parallel_work / 64))
+            for (size_type i = 0; i < size; ++ i) {
+                value_type bi = b [i], ri = r [i];
+                value_type ai = value_type/*zero*/(), ci = value_type/*zero*/();
+                if (i >= s) {
+                    const value_type k = a [i] / b [i - s];
+                    ai = - a [i - s] * k;
+                    bi -= c [i - s] * k;
+                    ri -= r [i - s] * k;
+                }
+                if (i + s < size) {
+                    const value_type k = c [i] / b [i + s];
+                    ci = - c [i + s] * k;
+                    bi -= a [i + s] * k;
+                    ri -= r [i + s] * k;
+                }
+                a2 [i] = ai;
+                b2 [i] = bi;
+                c2 [i] = ci;
+                r2 [i] = ri;
+            }
+            a.swap (a2);
+            b.swap (b2);
+            c.swap (c2);
+            r.swap (r2);
+        }
+        for (size_type i = 0; i < size; ++ i) {
+            const real_type bi = type_traits<value_type>::norm_inf (b [i]);
+            if (! (bi > real_type/*zero*/() && bi <= (std::numeric_limits<real_type>::max) ()))
+                return i + 1;
+        }
+#pragma omp parallel for if (size > size_type (detail::kernel_parallel_work / 64))
+        for (size_type i = 0; i < size; ++ i)
+            x () (i) = r [i] / b [i];
+        return 0;
+    }
+
+    /** \brief Solves many independent tridiagonal systems at once.
+     *
+     * Column \c k of \c dl, \c d, \c du and \c x holds the diagonals and the
+     * right hand side of system \c k, so that \c dl and \c du have one row
+     * less than \c d. The Thomas algorithm runs on blocks of 64 systems at a
+     * time, the inner loops going across the systems: with row major
+     * arguments they are contiguous and vectorise. Blocks run in parallel.
+     *
+     * \c x holds the right hand sides on entry and the solutions on return.
+     *
+     * \return 0 if no pivot vanished, else one plus the index of the first
+     * system with a zero pivot. The solution of such a system is not finite.
+     */
+    template<class E1, class E2, class E3, class E>
+    std::size_t batched_tridiagonal_solve (const matrix_expression<E1> &dl, const matrix_expression<E2> &d,
+                                           const matrix_expression<E3> &du, matrix_expression<E> &x) {
+        typedef std::size_t size_type;
+        typedef typename E::value_type value_type;
+
+        const size_type size = d ().size1 (), systems = d ().size2 ();
+        BOOST_UBLAS_CHECK (size == 0 || (dl ().size1 () + 1 == size && du ().size1 () + 1 == size), bad_size ());
+        BOOST_UBLAS_CHECK (dl ().size2 () == systems && du ().size2 () == systems, bad_size ());
+        BOOST_UBLAS_CHECK (x ().size1 () == size && x ().size2 () == systems, bad_size ());
+        if (size == 0)
+            return 0;
+        size_type singular = 0;
+        const size_type blocks = (systems + detail::kernel_block_m - 1) / detail::kernel_block_m;
+#pragma omp parallel for if (double (size) * systems > double (detail::kernel_parallel_work))
+        for (size_type block = 0; block < blocks; ++ block) {
+            const size_type k0 = block * detail::kernel_block_m, k1 = (std::min) (systems, size_type (k0 + detail::kernel_block_m));
+            const size_type width = k1 - k0;
+            // pivots w (i, k) at w [i * width + k - k0]
+            unbounded_array<value_type> w (size * width);
+            unbounded_array<unsigned char> zero (width, 0);
+            for (size_type k = k0; k < k1; ++ k) {
+                w [k - k0] = d () (0, k);
+                zero [k - k0] |= w [k - k0] == value_type/*zero*/();
+            }
+            for (size_type i = 1; i < size; ++ i) {
+                value_type *wi = &w [i * width];
+                const value_type *wp = &w [(i - 1) * width];
+                for (size_type k = k0; k < k1; ++ k) {
+                    const value_type mi = dl () (i - 1, k) / wp [k - k0];
+                    wi [k - k0] = d () (i, k) - mi * du () (i - 1, k);
+                    zero [k - k0] |= wi [k - k0] == value_type/*zero*/();
+                    x () (i, k) -= mi * x () (i - 1, k);
+                }
+            }
+            for (size_type k = k0; k < k1; ++ k)
+                x () (size - 1, k) /= w [(size - 1) * width + k - k0];
+            for (size_type i = size - 1; i > 0; -- i) {
+                const value_type *wp = &w [(i - 1) * width];
+                for (size_type k = k0; k < k1; ++ k)
+                    x () (i - 1, k) = (x () (i - 1, k) - du () (i - 1, k) * x () (i, k)) / wp [k - k0];
+            }
+            for (size_type k = k0; k < k1; ++ k) {
+                if (zero [k - k0]) {
+#pragma omp critical
+                    {
+                        if (singular == 0 || k + 1 < singular)
+                            singular = k + 1;
+                    }
+                    break;
+                }
+            }
+        }
+        return singular;
+    }
+
+}}}
+
+#endif
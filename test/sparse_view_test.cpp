@@ -104,3 +104,82 @@ BOOST_AUTO_TEST_CASE( test_construction_from_pointers )
     delete[] ia;
 
 }
+
+
+BOOST_AUTO_TEST_CASE( test_iterators_products_and_norms )
+{
+    typedef ublas::matrix<double> DENSE_MATRIX;
+    typedef ublas::vector<double> DENSE_VECTOR;
+
+    DENSE_MATRIX A;
+    std::istringstream iss(inputMatrix);
+    iss >> A;
+
+    typedef ublas::compressed_matrix_view<ublas::row_major, IB
+      , ublas::c_array_view<const unsigned int>
+      , ublas::c_array_view<const unsigned int>
+      , ublas::c_array_view<const double> > COMPMATVIEW;
+
+    COMPMATVIEW viewA(3,4,NNZ
+                      , ublas::c_array_view<const unsigned int>(4,&(IA[0]))
+                      , ublas::c_array_view<const unsigned int>(6,&(JA[0]))
+                      , ublas::c_array_view<const double>(6,&(VA[0])));
+
+    // the iterators visit the stored elements only
+    std::size_t visited = 0;
+    for (COMPMATVIEW::const_iterator1 it1 = viewA.begin1(); it1 != viewA.end1(); ++it1) {
+        for (COMPMATVIEW::const_iterator2 it2 = it1.begin(); it2 != it1.end(); ++it2) {
+            BOOST_CHECK_EQUAL( *it2, A(it2.index1(), it2.index2()) );
+            ++visited;
+        }
+    }
+    BOOST_CHECK_EQUAL( visited, NNZ );
+
+    BOOST_CHECK_EQUAL( double(ublas::norm_1(viewA)), double(ublas::norm_1(A)) );
+    BOOST_CHECK_EQUAL( double(ublas::norm_inf(viewA)), double(ublas::norm_inf(A)) );
+    BOOST_CHECK_CLOSE( double(ublas::norm_frobenius(viewA)), double(ublas::norm_frobenius(A)), 1e-12 );
+
+    DENSE_VECTOR x(4), y(3);
+    for (std::size_t i = 0; i < 4; ++i) x(i) = 1.0 + i;
+    for (std::size_t i = 0; i < 3; ++i) y(i) = 2.0 - i;
+
+    DENSE_VECTOR r(3);
+    ublas::axpy_prod(viewA, x, r, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(r - ublas::prod(A, x))), 1e-12 );
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(DENSE_VECTOR(ublas::prod(viewA, x)) - ublas::prod(A, x))), 1e-12 );
+
+    DENSE_VECTOR rt(4);
+    ublas::axpy_prod(y, viewA, rt, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(rt - ublas::prod(y, A))), 1e-12 );
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(DENSE_VECTOR(ublas::prod(ublas::trans(viewA), y)) - ublas::prod(y, A))), 1e-12 );
+
+    DENSE_MATRIX X(4, 2), R(3, 2);
+    for (std::size_t i = 0; i < 4; ++i) { X(i, 0) = 1.0 + i; X(i, 1) = 1.0 - 2.0 * i; }
+    ublas::axpy_prod(viewA, X, R, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(R - ublas::prod(A, X))), 1e-12 );
+
+    // a sparse result only stores the structural nonzeros
+    ublas::compressed_matrix<double> Xs(4, 2), Rs(3, 2);
+    Xs(1, 0) = 2.0;
+    Xs(3, 1) = -1.0;
+    ublas::axpy_prod(viewA, Xs, Rs, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(Rs - ublas::prod(A, Xs))), 1e-12 );
+    BOOST_CHECK_EQUAL( Rs.nnz(), std::size_t(3) );
+
+    // the same arrays read as the transposed matrix in column major layout
+    typedef ublas::compressed_matrix_view<ublas::column_major, IB
+      , ublas::c_array_view<const unsigned int>
+      , ublas::c_array_view<const unsigned int>
+      , ublas::c_array_view<const double> > COMPMATVIEW_T;
+
+    COMPMATVIEW_T viewAt(4,3,NNZ
+                         , ublas::c_array_view<const unsigned int>(4,&(IA[0]))
+                         , ublas::c_array_view<const unsigned int>(6,&(JA[0]))
+                         , ublas::c_array_view<const double>(6,&(VA[0])));
+
+    ublas::axpy_prod(viewAt, y, rt, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(rt - ublas::prod(y, A))), 1e-12 );
+    ublas::axpy_prod(x, viewAt, r, true);
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(r - ublas::prod(A, x))), 1e-12 );
+    BOOST_CHECK_SMALL( double(ublas::norm_inf(DENSE_MATRIX(ublas::trans(viewAt)) - A)), 1e-12 );
+}
@@ -12,6 +12,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include "../fixture_utility.hpp"
+#include <array>
 
 BOOST_AUTO_TEST_SUITE(test_algorithm_trans, 
     *boost::unit_test::description("Validate Transpose Algorithm")
@@ -323,4 +324,82 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(test_extents_static,
 }
 
 
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("transpose_algorithm")
+    *boost::unit_test::description("Testing the blocked transposition with extents larger than a tile")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_blocked, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using vector_t = std::vector<value_type>;
+    using permutation_type = std::vector<std::size_t>;
+
+    auto const collection = std::vector<ublas::extents<>>{
+        {40,33}, {37,20,18}, {17,1,35,3}, {2,130,3,40}, {300,400}
+    };
+
+    for(auto const& n : collection){
+        auto const rank = ublas::size(n);
+        auto const s = ublas::product(n);
+        auto const wa = ublas::to_strides(n,layout_type{});
+        auto a = vector_t(s);
+        ublas::iota(a, value_type{});
+
+        auto pi = permutation_type(rank);
+        std::iota(pi.begin(), pi.end(), 1ul);
+        do {
+            auto nc_base = n.base();
+            for(auto i = 0u; i < rank; ++i)
+                nc_base[pi[i]-1] = n[i];
+            auto const nc = ublas::extents<>(nc_base);
+            auto const wc = ublas::to_strides(nc,layout_type{});
+
+            // C[pi[i1],...,pi[ip]] = A[i1,...,ip] element by element
+            auto ref = vector_t(s);
+            auto idx = std::vector<std::size_t>(rank);
+            for(auto k = 0ul; k < s; ++k){
+                auto ja = 0ul, jc = 0ul;
+                for(auto r = 0u; r < rank; ++r){
+                    ja += idx[r]*wa[r];
+                    jc += idx[r]*wc[pi[r]-1];
+                }
+                ref[jc] = a[ja];
+                for(auto r = 0u; r < rank && ++idx[r] == n[r]; ++r)
+                    idx[r] = 0;
+            }
+
+            auto c = vector_t(s);
+            ublas::trans( rank, n.data(), pi.data(), c.data(), wc.data(), a.data(), wa.data() );
+            BOOST_CHECK( c == ref );
+        } while(std::next_permutation(pi.begin(), pi.end()));
+    }
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("transpose_algorithm")
+    *boost::unit_test::description("Testing the transposition in constant expressions")
+)
+BOOST_AUTO_TEST_CASE(test_constexpr)
+{
+    namespace ublas = boost::numeric::ublas;
+
+    // A[2,3] in first order, C = A^T in first order
+    constexpr auto c = []{
+        auto a  = std::array<int,6>{0,1,2,3,4,5};
+        auto c  = std::array<int,6>{};
+        auto n  = std::array<std::size_t,2>{2,3};
+        auto pi = std::array<std::size_t,2>{2,1};
+        auto wa = std::array<std::size_t,2>{1,2};
+        auto wc = std::array<std::size_t,2>{1,3};
+        ublas::trans( std::size_t{2}, n.data(), pi.data(), c.data(), wc.data(), a.data(), wa.data() );
+        return c;
+    }();
+
+    static_assert( c == std::array<int,6>{0,2,4,1,3,5} );
+    BOOST_CHECK( (c == std::array<int,6>{0,2,4,1,3,5}) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
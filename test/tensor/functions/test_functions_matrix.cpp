@@ -112,4 +112,55 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(test_tensor_static_rank,
 
 }
 
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("matrix_prod")
+    *boost::unit_test::description("Testing the chained matrix product for dynamic tensor")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_multi_ttm, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type  = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using inner_t     = inner_type_t<value_type>;
+    using tensor_type = ublas::tensor_dynamic<value_type, layout_type>;
+    using matrix_type = typename tensor_type::matrix_type;
+
+    auto a = tensor_type{ublas::extents<>{6,5,4,7}};
+    for(auto i = 0ul; i < a.size(); ++i)
+        a[i] = value_type( static_cast<inner_t>( int(i % 7) - 3 ) );
+
+    auto make_matrix = [](std::size_t rows, std::size_t cols, int seed){
+        auto u = matrix_type(rows, cols);
+        for(auto i = 0ul; i < rows; ++i)
+            for(auto j = 0ul; j < cols; ++j)
+                u(i,j) = value_type( static_cast<inner_t>( int((i*cols + j + seed) % 5) - 2 ) );
+        return u;
+    };
+
+    // shrinking, growing and square matrices in an order that differs from the chosen one
+    auto const u = std::vector<matrix_type>{ make_matrix(8,4,1), make_matrix(2,6,2), make_matrix(7,7,3) };
+    auto const modes = std::vector<std::size_t>{3,1,4};
+
+    auto const c = ublas::multi_ttm(a, u, modes);
+    auto const ref = ublas::prod(ublas::prod(ublas::prod(a, u[0], 3), u[1], 1), u[2], 4);
+    BOOST_REQUIRE( c.extents() == (ublas::extents<>{2,5,8,7}) );
+    BOOST_CHECK( std::equal(c.begin(), c.end(), ref.begin()) );
+
+    auto ut = std::vector<matrix_type>{};
+    for(auto const& x : u)
+        ut.push_back(ublas::trans(x));
+    auto const ct = ublas::multi_ttm(a, ut, modes, true);
+    BOOST_REQUIRE( ct.extents() == c.extents() );
+    BOOST_CHECK( std::equal(ct.begin(), ct.end(), c.begin()) );
+
+    auto const c1 = ublas::multi_ttm(a, {u[1]}, {1});
+    auto const r1 = ublas::prod(a, u[1], 1);
+    BOOST_CHECK( std::equal(c1.begin(), c1.end(), r1.begin()) );
+
+    BOOST_CHECK_THROW( ublas::multi_ttm(a, u, {3,1}),   std::length_error );
+    BOOST_CHECK_THROW( ublas::multi_ttm(a, u, {3,1,5}), std::length_error );
+    BOOST_CHECK_THROW( ublas::multi_ttm(a, u, {3,3,4}), std::invalid_argument );
+    BOOST_CHECK_THROW( ublas::multi_ttm(a, u, {1,3,4}), std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -160,4 +160,48 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(test_tensor_static_rank,
 // }
 
 
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("vector_prod")
+    *boost::unit_test::description("Testing the fused vector products for dynamic tensor")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_multi_ttv, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type  = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using inner_t     = inner_type_t<value_type>;
+    using tensor_type = ublas::tensor_dynamic<value_type, layout_type>;
+    using vector_type = typename tensor_type::vector_type;
+
+    auto a = tensor_type{ublas::extents<>{6,5,4,7}};
+    for(auto i = 0ul; i < a.size(); ++i)
+        a[i] = value_type( static_cast<inner_t>( int(i % 7) - 3 ) );
+
+    auto make_vector = [](std::size_t n, int seed){
+        auto v = vector_type(n);
+        for(auto i = 0ul; i < n; ++i)
+            v(i) = value_type( static_cast<inner_t>( int((i + seed) % 5) - 2 ) );
+        return v;
+    };
+
+    auto const b = std::vector<vector_type>{ make_vector(4,1), make_vector(6,2) };
+
+    auto const c = ublas::multi_ttv(a, b, {3,1});
+    auto const ref = ublas::prod(ublas::prod(a, b[0], 3), b[1], 1);
+    BOOST_REQUIRE( c.extents() == (ublas::extents<>{5,7}) );
+    BOOST_CHECK( std::equal(c.begin(), c.end(), ref.begin()) );
+
+    // contracting every mode leaves a scalar
+    auto const all = std::vector<vector_type>{ make_vector(6,1), make_vector(5,2), make_vector(4,3), make_vector(7,4) };
+    auto const s = ublas::multi_ttv(a, all, {1,2,3,4});
+    auto const r = ublas::prod(ublas::prod(ublas::prod(ublas::prod(a, all[3], 4), all[2], 3), all[1], 2), all[0], 1);
+    BOOST_REQUIRE( s.size() == 1ul );
+    BOOST_CHECK_EQUAL( s[0], r[0] );
+
+    BOOST_CHECK_THROW( ublas::multi_ttv(a, b, {3}),   std::length_error );
+    BOOST_CHECK_THROW( ublas::multi_ttv(a, b, {3,5}), std::length_error );
+    BOOST_CHECK_THROW( ublas::multi_ttv(a, b, {1,3}), std::length_error );
+    BOOST_CHECK_THROW( ublas::multi_ttv(a, b, {3,3}), std::length_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
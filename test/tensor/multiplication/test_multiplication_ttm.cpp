@@ -193,4 +193,68 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(test_extents_static,
     });
 }
 
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttm")
+    *boost::unit_test::description("Testing ttm with strided GEMMs against the scalar recursion")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_strided_gemm, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using vector_t = std::vector<value_type>;
+    using inner_t = inner_type_t<value_type>;
+
+    auto const collection = std::vector<ublas::extents<>>{
+        {40,12,30,16}, {300,20}, {7,64,1,5}, {1,150,33}
+    };
+
+    for(auto const& na : collection){
+        auto const rank = ublas::size(na);
+        auto const wa = ublas::to_strides(na,layout_type{});
+        auto a = vector_t(ublas::product(na));
+        for(auto i = 0ul; i < a.size(); ++i)
+            a[i] = value_type( static_cast<inner_t>( int(i % 7) - 3 ) );
+
+        for(auto m = std::size_t{0}; m < rank; ++m){
+            auto const nb = ublas::extents<>{24, na[m]};
+            auto const wb = ublas::to_strides(nb,layout_type{});
+            auto b = vector_t(ublas::product(nb));
+            for(auto i = 0ul; i < b.size(); ++i)
+                b[i] = value_type( static_cast<inner_t>( int(i % 5) - 2 ) );
+
+            auto nc_base = na.base();
+            nc_base[m] = nb[0];
+            auto const nc = ublas::extents<>(nc_base);
+            auto const wc = ublas::to_strides(nc,layout_type{});
+
+            auto c   = vector_t(ublas::product(nc), value_type{1});
+            auto ref = c;
+            ublas::ttm(m+1, rank,
+                       c.data(), nc.data(), wc.data(),
+                       a.data(), na.data(), wa.data(),
+                       b.data(), nb.data(), wb.data());
+            if(m != 0)
+                ublas::detail::recursive::ttm (m, rank-1, ref.data(), nc.data(), wc.data(), a.data(), na.data(), wa.data(), b.data(), nb.data(), wb.data());
+            else
+                ublas::detail::recursive::ttm0(   rank-1, ref.data(), nc.data(), wc.data(), a.data(), na.data(), wa.data(), b.data(), nb.data(), wb.data());
+            BOOST_CHECK( c == ref );
+
+            auto const plan = ublas::detail::make_ttm_plan(m+1, rank, wc.data(), na.data(), wa.data(), nb.data(), wb.data());
+            BOOST_CHECK_EQUAL( plan.batches*double(plan.m.extent)*double(nb[0])*double(na[m]), double(ublas::product(na))*double(nb[0]) );
+        }
+    }
+
+    // the free modes of A merge into a single GEMM for the outermost contiguous mode
+    auto const na = ublas::extents<>{40,12,30,16};
+    auto const nb = ublas::extents<>{24,40};
+    auto const nc = ublas::extents<>{24,12,30,16};
+    auto const wa = ublas::to_strides(na,ublas::layout::first_order{});
+    auto const wb = ublas::to_strides(nb,ublas::layout::first_order{});
+    auto const wc = ublas::to_strides(nc,ublas::layout::first_order{});
+    auto const plan = ublas::detail::make_ttm_plan(std::size_t{1}, std::size_t{4}, wc.data(), na.data(), wa.data(), nb.data(), wb.data());
+    BOOST_CHECK( plan.loops.empty() );
+    BOOST_CHECK_EQUAL( plan.m.extent, 12ul*30ul*16ul );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
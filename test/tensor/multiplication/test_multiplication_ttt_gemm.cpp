@@ -0,0 +1,202 @@
+//
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/test/unit_test.hpp>
+#include "../fixture_utility.hpp"
+#include <boost/numeric/ublas/tensor/multiplication.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_multiplication_ttt_gemm,
+    *boost::unit_test::description("Validate GEMM-based Tensor Times Tensor")
+)
+
+namespace {
+
+template<class value_type>
+auto make_values(std::size_t n, std::size_t seed)
+{
+    auto v = std::vector<value_type>(n);
+    for(auto i = 0ul; i < n; ++i)
+        v[i] = value_type( static_cast<inner_type_t<value_type>>( int((i*7 + seed) % 11) - 5 ) );
+    return v;
+}
+
+// computes the contraction with every method and compares it with the scalar recursion
+template<class value_type, class layout_type>
+void check_methods(boost::numeric::ublas::extents<> const& na,
+                   std::vector<std::size_t> const& pib,
+                   std::size_t q)
+{
+    namespace ublas = boost::numeric::ublas;
+    using extents_base_t = typename ublas::extents<>::base_type;
+
+    auto const pa = ublas::size(na);
+    auto nb_base = na.base();
+    for(auto j = 0u; j < pa; ++j)
+        nb_base[j] = na[pib[j]-1];
+    auto const nb = ublas::extents<>(nb_base);
+    auto const pb = pa;
+
+    // the first q modes of A are contracted with modes pib_inv of B
+    auto pib_inv = pib;
+    for(auto j = 0u; j < pb; ++j)
+        pib_inv[pib[j]-1] = j+1;
+    auto phia = std::vector<std::size_t>(pa);
+    std::iota(phia.begin(), phia.end(), q+1);
+    for(auto j = 0u; j < q; ++j)
+        phia[pa-q+j] = j+1;
+    auto phib = std::vector<std::size_t>(pb);
+    for(auto j = 0u; j < pb; ++j)
+        phib[j] = pib_inv[phia[j]-1];
+
+    auto const r = pa - q;
+    auto const s = pb - q;
+    auto nc_base = extents_base_t(std::max(r+s, std::size_t{2}), 1ul);
+    for(auto j = 0u; j < r; ++j)
+        nc_base[j] = na[phia[j]-1];
+    for(auto j = 0u; j < s; ++j)
+        nc_base[r+j] = nb[phib[j]-1];
+    auto const nc = ublas::extents<>(nc_base);
+
+    auto const wa = ublas::to_strides(na, layout_type{});
+    auto const wb = ublas::to_strides(nb, layout_type{});
+    auto const wc = ublas::to_strides(nc, layout_type{});
+    auto const a  = make_values<value_type>(ublas::product(na), 1);
+    auto const b  = make_values<value_type>(ublas::product(nb), 4);
+
+    auto ref = std::vector<value_type>(ublas::product(nc));
+    ublas::ttt(pa, pb, q, phia.data(), phib.data(),
+               ref.data(), nc.data(), wc.data(),
+               a.data(), na.data(), wa.data(),
+               b.data(), nb.data(), wb.data());
+
+    for(auto method : {ublas::contraction_method::loop_over_gemm, ublas::contraction_method::ttgt, ublas::contraction_method::automatic}){
+        auto c = std::vector<value_type>(ref.size());
+        ublas::ttt(pa, pb, q, phia.data(), phib.data(),
+                   c.data(), nc.data(), wc.data(),
+                   a.data(), na.data(), wa.data(),
+                   b.data(), nb.data(), wb.data(),
+                   method);
+        BOOST_CHECK( c == ref );
+    }
+}
+
+} // namespace
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttt_gemm")
+    *boost::unit_test::description("Testing the GEMM-based contractions against the scalar recursion")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_methods, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+
+    auto const collection = std::vector<ublas::extents<>>{
+        {4,3,5,2}, {5,1,3,6}, {1,4,1,3}, {3,7,2}, {9,6}
+    };
+
+    for(auto const& na : collection){
+        auto const pa = ublas::size(na);
+        auto pib = std::vector<std::size_t>(pa);
+        std::iota(pib.begin(), pib.end(), 1ul);
+        do {
+            for(auto q = 1ul; q <= pa; ++q)
+                check_methods<value_type,layout_type>(na, pib, q);
+        } while(std::next_permutation(pib.begin(), pib.end()));
+    }
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttt_gemm")
+    *boost::unit_test::description("Testing the GEMM-based contractions with several cache blocks")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_blocks, TestTupleType, boost::numeric::ublas::test_types)
+{
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+
+    // contracted extent larger than gemm_kc, free extents larger than gemm_mc
+    check_methods<value_type,layout_type>({130,20,15,3}, {3,2,4,1}, 2);
+    check_methods<value_type,layout_type>({300,5,131}, {1,3,2}, 1);
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttt_gemm")
+    *boost::unit_test::description("Testing the choice of the contraction method")
+)
+BOOST_AUTO_TEST_CASE(test_choice)
+{
+    namespace ublas = boost::numeric::ublas;
+    using layout_type = ublas::layout::first_order;
+
+    auto choose = [](ublas::extents<> const& na, ublas::extents<> const& nb, std::vector<std::size_t> const& phia, std::vector<std::size_t> const& phib, std::size_t q){
+        auto const pa = ublas::size(na), pb = ublas::size(nb);
+        auto nc_base = ublas::extents<>::base_type(std::max(pa+pb-2*q, std::size_t{2}), 1ul);
+        for(auto j = 0u; j < pa-q; ++j) nc_base[j]      = na[phia[j]-1];
+        for(auto j = 0u; j < pb-q; ++j) nc_base[pa-q+j] = nb[phib[j]-1];
+        auto const nc = ublas::extents<>(nc_base);
+        auto const wa = ublas::to_strides(na, layout_type{});
+        auto const wb = ublas::to_strides(nb, layout_type{});
+        auto const wc = ublas::to_strides(nc, layout_type{});
+        auto const modes = ublas::detail::make_contraction_modes(pa-q, pb-q, q, phia.data(), phib.data(), nc.data(), wc.data(), na.data(), wa.data(), wb.data());
+        return ublas::detail::choose_contraction_method(modes);
+    };
+
+    // tiny tensors stay with the scalar recursion
+    BOOST_CHECK( choose({2,3},{3,2},{1,2},{2,1},1) == ublas::contraction_method::recursive );
+
+    // C[a,b,i,j] = A[a,b,k,l] * B[k,l,i,j] is a single GEMM without copies
+    BOOST_CHECK( choose({24,24,24,24},{24,24,24,24},{1,2,3,4},{3,4,1,2},2) == ublas::contraction_method::loop_over_gemm );
+
+    // C[a,i,b,j] = A[a,k,b,l] * B[l,i,k,j] needs a transposition or loops over small GEMMs
+    auto const method = choose({24,24,24,24},{24,24,24,24},{1,3,2,4},{2,4,3,1},2);
+    BOOST_CHECK( method != ublas::contraction_method::recursive );
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttt_gemm")
+    *boost::unit_test::description("Testing prod for 4th-order tensors with the GEMM-based contractions")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_prod, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type  = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using tensor_type = ublas::tensor_dynamic<value_type, layout_type>;
+
+    auto a = tensor_type{ublas::extents<>{20,16,18,12}};
+    auto b = tensor_type{ublas::extents<>{12,18,14,16}};
+    auto const va = make_values<value_type>(a.size(), 2);
+    auto const vb = make_values<value_type>(b.size(), 3);
+    std::copy(va.begin(), va.end(), a.begin());
+    std::copy(vb.begin(), vb.end(), b.begin());
+
+    auto const phia = std::vector<std::size_t>{2,3};
+    auto const phib = std::vector<std::size_t>{4,2};
+    auto const c = ublas::prod(a, b, phia, phib);
+
+    // C[i,l,j,m] = sum(A[i,k1,k2,l] * B[j,k2,m,k1])
+    BOOST_REQUIRE( c.extents() == (ublas::extents<>{20,12,12,14}) );
+    for(auto i = 0ul; i < 20; ++i)
+        for(auto l = 0ul; l < 12; ++l)
+            for(auto j = 0ul; j < 12; ++j)
+                for(auto m = 0ul; m < 14; ++m){
+                    auto t = value_type{};
+                    for(auto k1 = 0ul; k1 < 16; ++k1)
+                        for(auto k2 = 0ul; k2 < 18; ++k2)
+                            t += a.at(i,k1,k2,l) * b.at(j,k2,m,k1);
+                    BOOST_CHECK_EQUAL( c.at(i,l,j,m), t );
+                }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
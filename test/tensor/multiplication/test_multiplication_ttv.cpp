@@ -232,4 +232,92 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(test_extents_static,
     });
 }
 
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("ttv")
+    *boost::unit_test::description("Testing ttv and multi_ttv against the scalar recursion")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_fused, TestTupleType, boost::numeric::ublas::test_types)
+{
+    namespace ublas = boost::numeric::ublas;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using vector_t = std::vector<value_type>;
+    using inner_t = inner_type_t<value_type>;
+    using base_t = typename ublas::extents<>::base_type;
+
+    auto make_values = [](std::size_t n, int seed){
+        auto v = vector_t(n);
+        for(auto i = 0ul; i < n; ++i)
+            v[i] = value_type( static_cast<inner_t>( int((i*3 + seed) % 7) - 3 ) );
+        return v;
+    };
+
+    // extents with innermost modes longer than a block and with modes of extent one
+    auto const collection = std::vector<ublas::extents<>>{
+        {3000,3,5}, {4,2500,3}, {30,1,20,9}, {1,40,1}, {600,400}
+    };
+
+    for(auto const& na : collection){
+        auto const rank = ublas::size(na);
+        auto const wa = ublas::to_strides(na,layout_type{});
+        auto const a = make_values(ublas::product(na), 1);
+
+        // ttv for every mode against the scalar recursion
+        for(std::size_t m = 0ul; m < rank; ++m){
+            auto const b  = make_values(na[m], 2);
+            auto const nb = ublas::extents<>{na[m],1ul};
+            auto const wb = ublas::to_strides(nb,layout_type{});
+            auto nc_base = base_t(std::max(rank-1u, std::size_t{2}), 1ul);
+            for(std::size_t i = 0ul, j = 0ul; i < rank; ++i)
+                if(i != m)
+                    nc_base[j++] = na[i];
+            auto const nc = ublas::extents<>(nc_base);
+            auto const wc = ublas::to_strides(nc,layout_type{});
+
+            auto c   = vector_t(ublas::product(nc), value_type{1});
+            auto ref = c;
+            ublas::ttv(m+1, rank,
+                       c.data(), nc.data(), wc.data(),
+                       a.data(), na.data(), wa.data(),
+                       b.data(), nb.data(), wb.data());
+            if(rank == 2)
+                ublas::detail::recursive::mtv(m, ref.data(), nc.data(), wc.data(), a.data(), na.data(), wa.data(), b.data());
+            else if(m == 0)
+                ublas::detail::recursive::ttv0(rank-1, ref.data(), nc.data(), wc.data(), a.data(), na.data(), wa.data(), b.data());
+            else
+                ublas::detail::recursive::ttv(m, rank-1, rank-2, ref.data(), nc.data(), wc.data(), a.data(), na.data(), wa.data(), b.data());
+            BOOST_CHECK( c == ref );
+        }
+
+        // multi_ttv for the first and the last mode against two ttv
+        if(rank < 3)
+            continue;
+        auto const b1 = make_values(na[0], 3);
+        auto const b2 = make_values(na[rank-1], 4);
+        auto nt_base = base_t(na.base().begin(), na.base().end()-1);
+        auto nc_base = base_t(std::max(rank-2u, std::size_t{2}), 1ul);
+        std::copy(na.base().begin()+1, na.base().end()-1, nc_base.begin());
+        auto const nt = ublas::extents<>(nt_base);
+        auto const nc = ublas::extents<>(nc_base);
+        auto const wt = ublas::to_strides(nt,layout_type{});
+        auto const wc = ublas::to_strides(nc,layout_type{});
+        auto const n1 = ublas::extents<>{na[0],1ul};
+        auto const n2 = ublas::extents<>{na[rank-1],1ul};
+
+        auto t   = vector_t(ublas::product(nt));
+        auto ref = vector_t(ublas::product(nc));
+        ublas::ttv(rank, rank, t.data(), nt.data(), wt.data(), a.data(), na.data(), wa.data(), b2.data(), n2.data(), n2.data());
+        ublas::ttv(std::size_t{1}, rank-1, ref.data(), nc.data(), wc.data(), t.data(), nt.data(), wt.data(), b1.data(), n1.data(), n1.data());
+
+        auto const modes = std::vector<std::size_t>{rank, 1ul};
+        auto const b = std::vector<value_type const*>{b2.data(), b1.data()};
+        auto c = vector_t(ublas::product(nc));
+        ublas::multi_ttv(std::size_t{2}, modes.data(), rank,
+                         c.data(), nc.data(), wc.data(),
+                         a.data(), na.data(), wa.data(),
+                         b.data());
+        BOOST_CHECK( c == ref );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
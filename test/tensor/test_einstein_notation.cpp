@@ -50,7 +50,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_dynamic,
             }
         }
 
-        auto AB = A(index::_,index::_e) * B(index::_e,index::_);
+        tensor_t AB = A(index::_,index::_e) * B(index::_e,index::_);
 
         for(auto j = 0u; j < AB.size(1); ++j){
             for(auto i = 0u; i < AB.size(0); ++i){
@@ -84,7 +84,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_dynamic,
             }
         }
 
-        auto AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
+        tensor_t AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
 
         auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
         auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
@@ -118,7 +118,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_dynamic,
             }
         }
 
-        auto AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
+        tensor_t AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
 
         // n*(n+1)/2;
         auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
@@ -166,7 +166,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static_rank,
             }
         }
 
-        auto AB = A(index::_,index::_e) * B(index::_e,index::_);
+        tensor2_t AB = A(index::_,index::_e) * B(index::_e,index::_);
 
         for(auto j = 0u; j < AB.size(1); ++j){
             for(auto i = 0u; i < AB.size(0); ++i){
@@ -200,7 +200,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static_rank,
             }
         }
 
-        auto AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
+        tensor2_t AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
 
         auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
         auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
@@ -214,155 +214,358 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static_rank,
 
     }
 
-    // FIXME: Enable this test after the issue #121 has been fixed.
-    // BOOST_TEST_CONTEXT("[Static Rank Tensor Einstien Notation] tensor with LHS[4, 3] : RHS[3, 4, 2]"){
+    BOOST_TEST_CONTEXT("[Static Rank Tensor Einstien Notation] tensor with LHS[4, 3] : RHS[3, 4, 2]"){
         
-    //     auto A = tensor2_t(4,3);
-    //     auto B = tensor3_t(3,4,2);
+        auto A = tensor2_t(4,3);
+        auto B = tensor3_t(3,4,2);
 
-    //     for(auto j = 0u; j < A.size(1); ++j){
-    //         for(auto i = 0u; i < A.size(0); ++i){
-    //             A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
-    //         }
-    //     }
+        for(auto j = 0u; j < A.size(1); ++j){
+            for(auto i = 0u; i < A.size(0); ++i){
+                A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
+            }
+        }
 
 
-    //     for(auto k = 0u; k < B.size(2); ++k){
-    //         for(auto j = 0u; j < B.size(1); ++j){
-    //             for(auto i = 0u; i < B.size(0); ++i){
-    //                 B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
-    //             }
-    //         }
-    //     }
+        for(auto k = 0u; k < B.size(2); ++k){
+            for(auto j = 0u; j < B.size(1); ++j){
+                for(auto i = 0u; i < B.size(0); ++i){
+                    B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
+                }
+            }
+        }
 
-    //     auto AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
+        tensor2_t AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
 
-    //     // n*(n+1)/2;
-    //     auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
-    //     auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
+        // n*(n+1)/2;
+        auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
+        auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
 
-    //     for(auto i = 0u; i < AB.size(0); ++i){
-    //         auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
-    //         BOOST_CHECK_EQUAL ( AB.at( i  ) , rhs );
-    //     }
+        for(auto i = 0u; i < AB.size(0); ++i){
+            auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
+            BOOST_CHECK_EQUAL ( AB.at( i  ) , rhs );
+        }
 
-    // }
+    }
 }
 
-// TODO: Add support of static tensor product then enable it.
-// BOOST_TEST_DECORATOR(
-//     *boost::unit_test::label("einstien_notation")
-//     *boost::unit_test::description("Testing the einstien notation for static tensor")
-// )
-// BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static,
-//     TestTupleType,
-//     boost::numeric::ublas::test_types
-// )
-// {
-//     namespace ublas = boost::numeric::ublas;
-//     namespace index = ublas::index;
-//     using value_type = typename TestTupleType::first_type;
-//     using layout_type = typename TestTupleType::second_type;
-//     using inner_t = inner_type_t<value_type>;
-
-//     BOOST_TEST_CONTEXT("[Static Tensor Einstien Notation] tensor with LHS[5, 3] : RHS[3, 4]"){
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("einstien_notation")
+    *boost::unit_test::description("Testing the einstien notation for static tensor")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static,
+    TestTupleType,
+    boost::numeric::ublas::test_types
+)
+{
+    namespace ublas = boost::numeric::ublas;
+    namespace index = ublas::index;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using inner_t = inner_type_t<value_type>;
+    // the einstein notation computes its result with a static rank
+    using result_t = ublas::tensor_static_rank<value_type, 2ul, layout_type>;
+
+    BOOST_TEST_CONTEXT("[Static Tensor Einstien Notation] tensor with LHS[5, 3] : RHS[3, 4]"){
         
-//         auto A = ublas::tensor_static<value_type, ublas::extents<5, 3>, layout_type>();
-//         auto B = ublas::tensor_static<value_type, ublas::extents<3, 4>, layout_type>();
-
-//         for(auto j = 0u; j < A.size(1); ++j){
-//             for(auto i = 0u; i < A.size(0); ++i){
-//                 A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
-//             }
-//         }
-
-//         for(auto j = 0u; j < B.size(1); ++j){
-//             for(auto i = 0u; i < B.size(0); ++i){
-//                 B.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
-//             }
-//         }
-
-//         auto AB = A(index::_,index::_e) * B(index::_e,index::_);
-
-//         for(auto j = 0u; j < AB.size(1); ++j){
-//             for(auto i = 0u; i < AB.size(0); ++i){
-//                 auto e0   = B.size(0);
-//                 auto sum  = std::div(e0 * ( e0 + 1 ), 2);
-//                 auto quot = value_type{ static_cast<inner_t>(sum.quot) };
-//                 BOOST_CHECK_EQUAL( AB.at(i,j) , A.at(i,0)*quot );
-//             }
-//         }
-
-//     }
-
-//     BOOST_TEST_CONTEXT("[Static Einstien Notation] tensor with LHS[4, 5, 3] : RHS[3, 4, 2]"){
+        auto A = ublas::tensor_static<value_type, ublas::extents<5, 3>, layout_type>();
+        auto B = ublas::tensor_static<value_type, ublas::extents<3, 4>, layout_type>();
+
+        for(auto j = 0u; j < A.size(1); ++j){
+            for(auto i = 0u; i < A.size(0); ++i){
+                A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
+            }
+        }
+
+        for(auto j = 0u; j < B.size(1); ++j){
+            for(auto i = 0u; i < B.size(0); ++i){
+                B.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
+            }
+        }
+
+        result_t AB = A(index::_,index::_e) * B(index::_e,index::_);
+
+        for(auto j = 0u; j < AB.size(1); ++j){
+            for(auto i = 0u; i < AB.size(0); ++i){
+                auto e0   = B.size(0);
+                auto sum  = std::div(e0 * ( e0 + 1 ), 2);
+                auto quot = value_type{ static_cast<inner_t>(sum.quot) };
+                BOOST_CHECK_EQUAL( AB.at(i,j) , A.at(i,0)*quot );
+            }
+        }
+
+    }
+
+    BOOST_TEST_CONTEXT("[Static Einstien Notation] tensor with LHS[4, 5, 3] : RHS[3, 4, 2]"){
         
-//         auto A = ublas::tensor_static<value_type, ublas::extents<4, 5, 3>, layout_type>();
-//         auto B = ublas::tensor_static<value_type, ublas::extents<3, 4, 2>, layout_type>();
-
-//         for(auto k = 0u; k < A.size(2); ++k){
-//             for(auto j = 0u; j < A.size(1); ++j){
-//                 for(auto i = 0u; i < A.size(0); ++i){
-//                 A.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
-//                 }
-//             }
-//         }
-
-//         for(auto k = 0u; k < B.size(2); ++k){
-//             for(auto j = 0u; j < B.size(1); ++j){
-//                 for(auto i = 0u; i < B.size(0); ++i){
-//                 B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
-//                 }
-//             }
-//         }
-
-//         auto AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
-
-//         auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
-//         auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
-
-//         for(auto j = 0u; j < AB.size(1); ++j){
-//             for(auto i = 0u; i < AB.size(0); ++i){
-//                 auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
-//                 BOOST_CHECK_EQUAL( AB.at( i,j ) , rhs );
-//             }
-//         }
-
-//     }
-
-//     // BOOST_TEST_CONTEXT("[Static Einstien Notation] tensor with LHS[4, 3] : RHS[3, 4, 2]"){
+        auto A = ublas::tensor_static<value_type, ublas::extents<4, 5, 3>, layout_type>();
+        auto B = ublas::tensor_static<value_type, ublas::extents<3, 4, 2>, layout_type>();
+
+        for(auto k = 0u; k < A.size(2); ++k){
+            for(auto j = 0u; j < A.size(1); ++j){
+                for(auto i = 0u; i < A.size(0); ++i){
+                A.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
+                }
+            }
+        }
+
+        for(auto k = 0u; k < B.size(2); ++k){
+            for(auto j = 0u; j < B.size(1); ++j){
+                for(auto i = 0u; i < B.size(0); ++i){
+                B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
+                }
+            }
+        }
+
+        result_t AB = A(index::_d,index::_,index::_f) * B(index::_f,index::_d,index::_);
+
+        auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
+        auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
+
+        for(auto j = 0u; j < AB.size(1); ++j){
+            for(auto i = 0u; i < AB.size(0); ++i){
+                auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
+                BOOST_CHECK_EQUAL( AB.at( i,j ) , rhs );
+            }
+        }
+
+    }
+
+    BOOST_TEST_CONTEXT("[Static Einstien Notation] tensor with LHS[4, 3] : RHS[3, 4, 2]"){
         
-//     //     auto A = ublas::tensor_static<value_type, ublas::extents<4, 3>, layout_type>();
-//     //     auto B = ublas::tensor_static<value_type, ublas::extents<3, 4, 2>, layout_type>();
+        auto A = ublas::tensor_static<value_type, ublas::extents<4, 3>, layout_type>();
+        auto B = ublas::tensor_static<value_type, ublas::extents<3, 4, 2>, layout_type>();
+
+        for(auto j = 0u; j < A.size(1); ++j){
+            for(auto i = 0u; i < A.size(0); ++i){
+                A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
+            }
+        }
+
+
+        for(auto k = 0u; k < B.size(2); ++k){
+            for(auto j = 0u; j < B.size(1); ++j){
+                for(auto i = 0u; i < B.size(0); ++i){
+                    B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
+                }
+            }
+        }
+
+        result_t AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
+
+        // n*(n+1)/2;
+        auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
+        auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
+
+        for(auto i = 0u; i < AB.size(0); ++i){
+            auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
+            BOOST_CHECK_EQUAL ( AB.at( i  ) , rhs );
+        }
+
+    }
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("einstien_notation")
+    *boost::unit_test::description("Testing the einstien notation for chains of tensors")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_chain,
+    TestTupleType,
+    boost::numeric::ublas::test_types
+)
+{
+    namespace ublas = boost::numeric::ublas;
+    using namespace ublas::index;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using inner_t = inner_type_t<value_type>;
+    using tensor_t = ublas::tensor_dynamic<value_type, layout_type>;
+
+    auto fill = [](auto& t, int seed){
+        for(auto i = 0u; i < t.size(); ++i)
+            t[i] = value_type{ static_cast< inner_t >( int((i*7 + seed) % 11) - 5 ) };
+    };
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] A[i,j] * B[j,k] * C[k,l]"){
+
+        auto A = tensor_t{5,3};
+        auto B = tensor_t{3,4};
+        auto C = tensor_t{4,6};
+        fill(A,1); fill(B,2); fill(C,3);
 
-//     //     for(auto j = 0u; j < A.size(1); ++j){
-//     //         for(auto i = 0u; i < A.size(0); ++i){
-//     //             A.at( i,j ) = value_type{ static_cast< inner_t >(i+1) };
-//     //         }
-//     //     }
+        tensor_t D = A(_i,_j) * B(_j,_k) * C(_k,_l);
+        auto const E = ublas::prod( ublas::prod(A,B,std::vector<std::size_t>{2},std::vector<std::size_t>{1}), C, std::vector<std::size_t>{2}, std::vector<std::size_t>{1} );
 
+        BOOST_REQUIRE( D.extents() == E.extents() );
+        for(auto i = 0u; i < D.size(); ++i)
+            BOOST_CHECK_EQUAL( D[i], E[i] );
+    }
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] A[i,_,j] * B[k,j] * C[k,i,_] * v[_,l] + 1"){
+
+        auto A = tensor_t{4,3,5};
+        auto B = tensor_t{6,5};
+        auto C = tensor_t{6,4,2};
+        auto v = tensor_t{7,1};
+        fill(A,4); fill(B,5); fill(C,6); fill(v,7);
+
+        tensor_t D = A(_i,_,_j) * B(_k,_j) * C(_k,_i,_) * v(_,_l) + 1;
+
+        BOOST_REQUIRE( D.extents() == (ublas::extents<>{3,2,7,1}) );
+        for(auto a = 0u; a < 3; ++a)
+            for(auto b = 0u; b < 2; ++b)
+                for(auto c = 0u; c < 7; ++c){
+                    auto t = value_type{1};
+                    for(auto i = 0u; i < 4; ++i)
+                        for(auto j = 0u; j < 5; ++j)
+                            for(auto k = 0u; k < 6; ++k)
+                                t += A.at(i,a,j) * B.at(k,j) * C.at(k,i,b) * v.at(c,0);
+                    BOOST_CHECK_EQUAL( D.at(a,b,c,0), t );
+                }
+    }
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] full contraction A[i,j] * B[j,k] * C[k,i]"){
+
+        auto A = tensor_t{3,4};
+        auto B = tensor_t{4,5};
+        auto C = tensor_t{5,3};
+        fill(A,8); fill(B,9); fill(C,10);
 
-//     //     for(auto k = 0u; k < B.size(2); ++k){
-//     //         for(auto j = 0u; j < B.size(1); ++j){
-//     //             for(auto i = 0u; i < B.size(0); ++i){
-//     //                 B.at( i,j,k ) = value_type{ static_cast< inner_t >(i+1) };
-//     //             }
-//     //         }
-//     //     }
+        tensor_t const D = A(_i,_j) * (B(_j,_k) * C(_k,_i));
 
-//     //     auto AB = A(index::_d,index::_f) * B(index::_f,index::_d,index::_);
+        auto t = value_type{};
+        for(auto i = 0u; i < 3; ++i)
+            for(auto j = 0u; j < 4; ++j)
+                for(auto k = 0u; k < 5; ++k)
+                    t += A.at(i,j) * B.at(j,k) * C.at(k,i);
+        BOOST_REQUIRE_EQUAL( D.size(), 1u );
+        BOOST_CHECK_EQUAL( D[0], t );
+    }
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] disjoint leading pair A[i,j] * B[k,l] * C[j,k]"){
+
+        auto A = tensor_t{3,4};
+        auto B = tensor_t{5,2};
+        auto C = tensor_t{4,5};
+        fill(A,11); fill(B,12); fill(C,13);
 
-//     //     // n*(n+1)/2;
-//     //     auto const nf = ( B.size(0) * (B.size(0)+1) / 2 );
-//     //     auto const nd = ( A.size(0) * (A.size(0)+1) / 2 );
+        tensor_t D = A(_i,_j) * B(_k,_l) * C(_j,_k);
 
-//     //     for(auto i = 0u; i < AB.size(0); ++i){
-//     //         auto const rhs = value_type{ static_cast< inner_t >(nf * nd) };
-//     //         BOOST_CHECK_EQUAL ( AB.at( i  ) , rhs );
-//     //     }
+        BOOST_REQUIRE( D.extents() == (ublas::extents<>{3,2}) );
+        for(auto i = 0u; i < 3; ++i)
+            for(auto l = 0u; l < 2; ++l){
+                auto t = value_type{};
+                for(auto j = 0u; j < 4; ++j)
+                    for(auto k = 0u; k < 5; ++k)
+                        t += A.at(i,j) * B.at(k,l) * C.at(j,k);
+                BOOST_CHECK_EQUAL( D.at(i,l), t );
+            }
+
+        // outer product
+        tensor_t E = A(_i,_j) * B(_k,_l);
+        BOOST_REQUIRE( E.extents() == (ublas::extents<>{3,4,5,2}) );
+        for(auto i = 0u; i < 3; ++i)
+            for(auto j = 0u; j < 4; ++j)
+                for(auto k = 0u; k < 5; ++k)
+                    for(auto l = 0u; l < 2; ++l)
+                        BOOST_CHECK_EQUAL( E.at(i,j,k,l), A.at(i,j) * B.at(k,l) );
+    }
 
-//     // }
-// }
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] the expression is evaluated on first access"){
+
+        auto A = tensor_t{3,4};
+        auto B = tensor_t{4,2};
+        fill(A,14); fill(B,15);
+
+        // auto keeps the lazy expression that refers to A and B
+        auto const lazy = A(_i,_j) * B(_j,_k);
+        tensor_t const value = A(_i,_j) * B(_j,_k);
+        A.at(0,0) += value_type{ static_cast< inner_t >(1) };
+
+        BOOST_CHECK_EQUAL( lazy.at(0,0), value.at(0,0) + B.at(0,0) );
+    }
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] order of the contractions"){
+
+        auto A = tensor_t{40,40};
+        auto B = tensor_t{40,40};
+        auto C = tensor_t{40,2};
+        auto const ABC = A(_i,_j) * B(_j,_k) * C(_k,_l);
+        auto const plan = ABC.plan();
+
+        // B*C is contracted before A
+        BOOST_CHECK_EQUAL( plan.steps[0][0], 1u );
+        BOOST_CHECK_EQUAL( plan.steps[0][1], 2u );
+        BOOST_CHECK_EQUAL( plan.steps[1][0], 0u );
+        BOOST_CHECK_EQUAL( plan.steps[1][1], 3u );
+    }
+
+    BOOST_TEST_CONTEXT("[Einstien Notation Chain] twelve matrices"){
+
+        auto M = std::vector<tensor_t>{};
+        for(auto i = 0u; i < 12; ++i){
+            M.emplace_back(ublas::extents<>{2+i%3, 2+(i+1)%3});
+            for(auto j = 0u; j < M.back().size(); ++j)
+                M.back()[j] = value_type{ static_cast< inner_t >( int((i+j) % 3) - 1 ) };
+        }
+
+        tensor_t D = M[0](_a,_b) * M[1](_b,_c) * M[2](_c,_d) * M[3](_d,_e) * M[4](_e,_f) * M[5](_f,_g) *
+                     M[6](_g,_h) * M[7](_h,_i) * M[8](_i,_j) * M[9](_j,_k) * M[10](_k,_l) * M[11](_l,_m);
+
+        auto E = M[0];
+        for(auto i = 1u; i < 12; ++i)
+            E = ublas::prod(E, M[i], std::vector<std::size_t>{2}, std::vector<std::size_t>{1});
+
+        BOOST_REQUIRE( D.extents() == E.extents() );
+        for(auto i = 0u; i < D.size(); ++i)
+            BOOST_CHECK_EQUAL( D[i], E[i] );
+    }
+}
+
+
+BOOST_TEST_DECORATOR(
+    *boost::unit_test::label("einstien_notation")
+    *boost::unit_test::description("Testing the einstien notation for chains of static tensors")
+)
+BOOST_AUTO_TEST_CASE_TEMPLATE(test_tensor_static_chain,
+    TestTupleType,
+    boost::numeric::ublas::test_types
+)
+{
+    namespace ublas = boost::numeric::ublas;
+    using namespace ublas::index;
+    using value_type = typename TestTupleType::first_type;
+    using layout_type = typename TestTupleType::second_type;
+    using inner_t = inner_type_t<value_type>;
+
+    auto A = ublas::tensor_static<value_type, ublas::extents<30,30>, layout_type>();
+    auto B = ublas::tensor_static<value_type, ublas::extents<30,30>, layout_type>();
+    auto v = ublas::tensor_static<value_type, ublas::extents<30,1> , layout_type>();
+    for(auto i = 0u; i < A.size(); ++i){
+        A[i] = value_type{ static_cast< inner_t >( int(i % 7) - 3 ) };
+        B[i] = value_type{ static_cast< inner_t >( int(i % 5) - 2 ) };
+    }
+    for(auto i = 0u; i < v.size(); ++i)
+        v[i] = value_type{ static_cast< inner_t >( int(i % 3) - 1 ) };
+
+    auto const ABv = A(_i,_j) * B(_j,_k) * v(_k,_);
+
+    // the order is computed at compile time
+    using labels_type = ublas::detail::einstein_result<decltype(A(_i,_j)), decltype(B(_j,_k)), decltype(v(_k,_))>;
+    constexpr auto plan = ublas::detail::make_einstein_plan(labels_type::labels.mask,
+        ublas::detail::make_einstein_extents(labels_type::labels, ublas::extents<30,30>{}, ublas::extents<30,30>{}, ublas::extents<30,1>{}));
+    static_assert( plan.steps[0][0] == 1 && plan.steps[0][1] == 2 );
+    BOOST_CHECK( ABv.plan().steps == plan.steps );
+
+    BOOST_REQUIRE( ABv.extents() == (ublas::extents<2>{30,1}) );
+    for(auto i = 0u; i < 30; ++i){
+        auto t = value_type{};
+        for(auto j = 0u; j < 30; ++j)
+            for(auto k = 0u; k < 30; ++k)
+                t += A.at(i,j) * B.at(j,k) * v.at(k,0);
+        BOOST_CHECK_EQUAL( ABv.at(i,0), t );
+    }
+}
 
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -164,6 +164,30 @@ void test_matrix () {
 #endif
 #endif
 
+#ifdef USE_HASH_MAP_ARRAY
+#ifdef USE_FLOAT
+    std::cout << "float, mapped_matrix hash_map_array" << std::endl;
+    test_my_matrix<ublas::mapped_matrix<float, ublas::row_major, ublas::hash_map_array<std::size_t, float> >, 3 > () ();
+#endif
+
+#ifdef USE_DOUBLE
+    std::cout << "double, mapped_matrix hash_map_array" << std::endl;
+    test_my_matrix<ublas::mapped_matrix<double, ublas::row_major, ublas::hash_map_array<std::size_t, double> >, 3 > () ();
+#endif
+
+#ifdef USE_STD_COMPLEX
+#ifdef USE_FLOAT
+    std::cout << "std::complex<float>, mapped_matrix hash_map_array" << std::endl;
+    test_my_matrix<ublas::mapped_matrix<std::complex<float>, ublas::row_major, ublas::hash_map_array<std::size_t, std::complex<float> > >, 3 > () ();
+#endif
+
+#ifdef USE_DOUBLE
+    std::cout << "std::complex<double>, mapped_matrix hash_map_array" << std::endl;
+    test_my_matrix<ublas::mapped_matrix<std::complex<double>, ublas::row_major, ublas::hash_map_array<std::size_t, std::complex<double> > >, 3 > () ();
+#endif
+#endif
+#endif
+
 #ifdef USE_STD_MAP
 #ifdef USE_FLOAT
     std::cout << "float, mapped_matrix std::map" << std::endl;
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-12);
+
+double random_value () {
+    return double (std::rand ()) / RAND_MAX - 0.5;
+}
+
+ublas::vector<double> random_vector (std::size_t size) {
+    ublas::vector<double> v (size);
+    for (std::size_t i = 0; i < size; ++ i)
+        v (i) = random_value ();
+    return v;
+}
+
+template<class V1, class V2>
+bool vector_close (const V1 &v1, const V2 &v2) {
+    return v1.size () == v2.size () && ublas::norm_inf (v1 - v2) < TOL;
+}
+
+// Products with square and rectangular bands, with and without init
+template<class B>
+void check_banded (std::size_t size1, std::size_t size2, std::size_t lower, std::size_t upper, std::size_t &test_fails__) {
+    B A (size1, size2, lower, upper);
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = i - (std::min) (i, lower); j < (std::min) (size2, i + upper + 1); ++ j)
+            A (i, j) = random_value ();
+    const ublas::matrix<double> D (A);
+    const ublas::vector<double> x (random_vector (size2)), y (random_vector (size1));
+
+    ublas::vector<double> v (size1);
+    ublas::axpy_prod (A, x, v);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, ublas::prod (D, x)));
+    v = y;
+    ublas::axpy_prod (A, x, v, false);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, y + ublas::prod (D, x)));
+    BOOST_UBLAS_TEST_CHECK (vector_close ((ublas::axpy_prod<ublas::vector<double> > (A, x)), ublas::prod (D, x)));
+}
+
+template<class B>
+BOOST_UBLAS_TEST_DEF ( test_banded_matrix_prod )
+{
+    check_banded<B> (1000, 1000, 2, 3, test_fails__);
+    check_banded<B> (1000, 1000, 0, 0, test_fails__);
+    check_banded<B> (600, 1000, 4, 1, test_fails__);
+    check_banded<B> (1000, 600, 1, 4, test_fails__);
+    check_banded<B> (3000, 3000, 40, 25, test_fails__);
+}
+
+// The adaptor reads the band of a dense matrix in its orientation
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_banded_adaptor_prod )
+{
+    const std::size_t size1 = 700, size2 = 500;
+    M D (size1, size2);
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = 0; j < size2; ++ j)
+            D (i, j) = random_value ();
+    const ublas::banded_adaptor<const M> A (D, 3, 7);
+    const ublas::matrix<double> E (A);
+    const ublas::vector<double> x (random_vector (size2)), y (random_vector (size1));
+
+    ublas::vector<double> v (size1);
+    ublas::axpy_prod (A, x, v);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, ublas::prod (E, x)));
+    v = y;
+    ublas::axpy_prod (A, x, v, false);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, y + ublas::prod (E, x)));
+}
+
+// Diagonal products scale the elements of x and the rows of X
+template<class L>
+BOOST_UBLAS_TEST_DEF ( test_diagonal_prod )
+{
+    const std::size_t size = 500;
+    ublas::diagonal_matrix<double, L> A (size);
+    for (std::size_t i = 0; i < size; ++ i)
+        A (i, i) = random_value ();
+    const ublas::matrix<double> D (A);
+    const ublas::vector<double> x (random_vector (size)), y (random_vector (size));
+
+    ublas::vector<double> v (size);
+    ublas::axpy_prod (A, x, v);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, ublas::prod (D, x)));
+    v = y;
+    ublas::axpy_prod (A, x, v, false);
+    BOOST_UBLAS_TEST_CHECK (vector_close (v, y + ublas::prod (D, x)));
+
+    ublas::matrix<double> X (size, 9), R (size, 9);
+    for (std::size_t i = 0; i < size; ++ i)
+        for (std::size_t j = 0; j < 9; ++ j)
+            X (i, j) = random_value ();
+    ublas::axpy_prod (A, X, R);
+    const ublas::matrix<double> P (ublas::prod (D, X));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R, P, size, 9, TOL);
+    ublas::axpy_prod (A, X, R, false);
+    const ublas::matrix<double> P2 (2.0 * P);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R, P2, size, 9, TOL);
+
+    // a rectangular diagonal matrix leaves the rows below its diagonal zero
+    ublas::diagonal_matrix<double, L> B (size + 5, size);
+    for (std::size_t i = 0; i < size; ++ i)
+        B (i, i) = random_value ();
+    ublas::vector<double> w (size + 5);
+    ublas::axpy_prod (B, x, w);
+    BOOST_UBLAS_TEST_CHECK (vector_close (w, ublas::prod (ublas::matrix<double> (B), x)));
+}
+
+int main () {
+    typedef ublas::banded_matrix<double, ublas::row_major> row_banded;
+    typedef ublas::banded_matrix<double, ublas::column_major> column_banded;
+    typedef ublas::matrix<double, ublas::row_major> row_matrix;
+    typedef ublas::matrix<double, ublas::column_major> column_matrix;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_banded_matrix_prod<row_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_matrix_prod<column_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_adaptor_prod<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_banded_adaptor_prod<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_diagonal_prod<ublas::row_major> );
+    BOOST_UBLAS_TEST_DO( test_diagonal_prod<ublas::column_major> );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,158 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/cholesky.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+static const std::size_t n(300);
+
+double random_value () {
+    return double (std::rand ()) / RAND_MAX - 0.5;
+}
+
+// Random band with a weak diagonal, so that the factorization has to pivot
+template<class B>
+B random_banded (std::size_t lower, std::size_t upper, double diagonal) {
+    B A (n, n, lower, upper);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = i - (std::min) (i, lower); j < (std::min) (n, i + upper + 1); ++ j)
+            A (i, j) = i == j ? diagonal + random_value () : random_value ();
+    return A;
+}
+
+ublas::matrix<double> rhs (std::size_t size2) {
+    ublas::matrix<double> X (n, size2);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < size2; ++ j)
+            X (i, j) = 1.0 + double (i + 3 * j) / n;
+    return X;
+}
+
+// Solve for one and for several right hand sides after a pivoted factorization
+template<class B>
+BOOST_UBLAS_TEST_DEF ( test_banded_lu )
+{
+    const B A (random_banded<B> (3, 5, 1.0));
+    const ublas::matrix<double> D (A);
+    B F (A);
+    ublas::permutation_matrix<std::size_t> pm (n);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::banded_lu_factorize (F, pm), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (F.lower (), std::size_t (3));
+    BOOST_UBLAS_TEST_CHECK_EQ (F.upper (), std::size_t (8));
+    std::size_t swaps = 0;
+    for (std::size_t i = 0; i < n; ++ i)
+        swaps += pm (i) != i;
+    BOOST_UBLAS_TEST_CHECK (swaps > 0);
+
+    const ublas::matrix<double> X (rhs (7));
+    ublas::vector<double> b (ublas::prod (D, ublas::column (X, 0)));
+    ublas::banded_lu_substitute (F, pm, b);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), X (i, 0), TOL);
+
+    ublas::matrix<double> R (ublas::prod (D, X));
+    ublas::banded_lu_substitute (F, pm, R);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R, X, n, 7, TOL);
+
+    // a zero column is reported and does not stop the factorization
+    B S (A);
+    for (std::size_t i = 11 - 5; i <= 11 + 3; ++ i)
+        S (i, 11) = 0.0;
+    ublas::permutation_matrix<std::size_t> ps (n);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::banded_lu_factorize (S, ps), std::size_t (12));
+}
+
+// The band Cholesky factor agrees with the dense one
+template<class B>
+BOOST_UBLAS_TEST_DEF ( test_banded_cholesky )
+{
+    B A (n, n, 4, 4);
+    for (std::size_t i = 0; i < n; ++ i) {
+        A (i, i) = 10.0 + random_value ();
+        for (std::size_t j = i - (std::min) (i, std::size_t (4)); j < i; ++ j)
+            A (i, j) = A (j, i) = random_value ();
+    }
+    const ublas::matrix<double> D (A);
+    ublas::matrix<double> C (D);
+    B F (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (C), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (F), std::size_t (0));
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = i - (std::min) (i, std::size_t (4)); j <= i; ++ j)
+            BOOST_UBLAS_TEST_CHECK (std::abs (F (i, j) - C (i, j)) < TOL);
+
+    const ublas::matrix<double> X (rhs (5));
+    ublas::vector<double> b (ublas::prod (D, ublas::column (X, 2)));
+    ublas::cholesky_substitute (F, b);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), X (i, 2), TOL);
+    ublas::matrix<double> R (ublas::prod (D, X));
+    ublas::cholesky_substitute (F, R);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R, X, n, 5, TOL);
+
+    B G (A);
+    G (57, 57) = -1.0;
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (G), std::size_t (58));
+}
+
+// Band triangular solves agree with the dense triangular solves
+template<class B>
+BOOST_UBLAS_TEST_DEF ( test_banded_triangular )
+{
+    const B A (random_banded<B> (2, 6, 4.0));
+    const ublas::matrix<double> D (A);
+    const ublas::matrix<double> X (rhs (9));
+    ublas::matrix<double> R1 (X), R2 (X);
+
+    ublas::inplace_solve (A, R1, ublas::lower_tag ());
+    ublas::inplace_solve (D, R2, ublas::lower_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R1, R2, n, 9, TOL);
+    R1 = X; R2 = X;
+    ublas::inplace_solve (A, R1, ublas::unit_lower_tag ());
+    ublas::inplace_solve (D, R2, ublas::unit_lower_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R1, R2, n, 9, TOL);
+    R1 = X; R2 = X;
+    ublas::inplace_solve (A, R1, ublas::upper_tag ());
+    ublas::inplace_solve (D, R2, ublas::upper_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R1, R2, n, 9, TOL);
+    R1 = X; R2 = X;
+    ublas::inplace_solve (A, R1, ublas::unit_upper_tag ());
+    ublas::inplace_solve (D, R2, ublas::unit_upper_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R1, R2, n, 9, TOL);
+
+    ublas::vector<double> v1 (ublas::column (X, 4)), v2 (v1);
+    ublas::inplace_solve (A, v1, ublas::upper_tag ());
+    ublas::inplace_solve (D, v2, ublas::upper_tag ());
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (v1 (i), v2 (i), TOL);
+}
+
+int main () {
+    typedef ublas::banded_matrix<double, ublas::row_major> row_banded;
+    typedef ublas::banded_matrix<double, ublas::column_major> column_banded;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_banded_lu<row_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_lu<column_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_cholesky<row_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_cholesky<column_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_triangular<row_banded> );
+    BOOST_UBLAS_TEST_DO( test_banded_triangular<column_banded> );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/cholesky.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+typedef ublas::matrix<double, ublas::row_major> row_matrix;
+typedef ublas::matrix<double, ublas::column_major> column_matrix;
+typedef ublas::symmetric_matrix<double, ublas::lower> lower_symmetric;
+typedef ublas::symmetric_matrix<double, ublas::upper> upper_symmetric;
+
+// A = B * trans (B) + n * I
+ublas::matrix<double> spd_matrix (std::size_t n) {
+    ublas::matrix<double> B (n, n);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < n; ++ j)
+            B (i, j) = double (std::rand ()) / RAND_MAX - 0.5;
+    ublas::matrix<double> A (ublas::prod (B, ublas::trans (B)));
+    for (std::size_t i = 0; i < n; ++ i)
+        A (i, i) += n;
+    return A;
+}
+
+// L * trans (L) reproduces A, both for the plain and the tiled factorization
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_factorize )
+{
+    const std::size_t n = 150;
+    const ublas::matrix<double> A (spd_matrix (n));
+    M C1 (A), C2 (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (C1), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (C2, 32), std::size_t (0));
+
+    ublas::matrix<double> L1 ((ublas::triangular_adaptor<M, ublas::lower> (C1)));
+    ublas::matrix<double> L2 ((ublas::triangular_adaptor<M, ublas::lower> (C2)));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (L1, L2, n, n, TOL);
+    ublas::matrix<double> LLt (ublas::prod (L1, ublas::trans (L1)));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LLt, A, n, n, TOL * n);
+}
+
+// Solve for one and for several right hand sides
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_substitute )
+{
+    const std::size_t n = 90;
+    const ublas::matrix<double> A (spd_matrix (n));
+    M C (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (C, 16), std::size_t (0));
+
+    ublas::vector<double> x (n);
+    for (std::size_t i = 0; i < n; ++ i)
+        x (i) = 1.0 + double (i) / n;
+    ublas::vector<double> b (ublas::prod (A, x));
+    ublas::cholesky_substitute (C, b);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+
+    ublas::matrix<double> X (n, 3);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < 3; ++ j)
+            X (i, j) = 1.0 + double (i + j) / n;
+    ublas::matrix<double> B (ublas::prod (A, X));
+    ublas::cholesky_substitute (C, B);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (B, X, n, 3, TOL);
+}
+
+// The first non positive pivot is reported by both variants
+BOOST_UBLAS_TEST_DEF ( test_not_positive_definite )
+{
+    const std::size_t n = 60;
+    ublas::matrix<double> A (spd_matrix (n));
+    A (37, 37) = -1.0;
+    row_matrix C1 (A), C2 (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (C1), std::size_t (38));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (C2, 8), std::size_t (38));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (C2 = A, 64), std::size_t (38));
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_factorize<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_factorize<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_factorize<lower_symmetric> );
+    BOOST_UBLAS_TEST_DO( test_factorize<upper_symmetric> );
+    BOOST_UBLAS_TEST_DO( test_substitute<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_substitute<lower_symmetric> );
+    BOOST_UBLAS_TEST_DO( test_not_positive_definite );
+
+    BOOST_UBLAS_TEST_END();
+}
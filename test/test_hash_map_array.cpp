@@ -0,0 +1,105 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+typedef ublas::hash_map_array<std::size_t, double> hash_array;
+
+static const std::size_t size1(37);
+static const std::size_t size2(23);
+
+// visit the elements of a pseudo random pattern in a scrambled order
+std::size_t scrambled (std::size_t k) {
+    return (k * 7919) % (size1 * size2);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_array ) {
+    hash_array a;
+    for (std::size_t k = 0; k < 500; ++ k)
+        a [scrambled (k)] += double (k);
+    BOOST_UBLAS_TEST_CHECK_EQ (a.size (), std::size_t (500));
+    BOOST_UBLAS_TEST_CHECK (! a.sorted ());
+    BOOST_UBLAS_TEST_CHECK (a.find (scrambled (42)) != a.end ());
+    BOOST_UBLAS_TEST_CHECK_EQ (a.find (scrambled (42))->second, 42.0);
+    BOOST_UBLAS_TEST_CHECK (a.find (scrambled (600)) == a.end ());
+
+    // ordered access sorts once, lookups keep working afterwards
+    hash_array::const_iterator it = a.begin ();
+    BOOST_UBLAS_TEST_CHECK (a.sorted ());
+    for (++ it; it != a.end (); ++ it)
+        BOOST_UBLAS_TEST_CHECK ((it - 1)->first < it->first);
+    BOOST_UBLAS_TEST_CHECK_EQ (a.find (scrambled (499))->second, 499.0);
+    BOOST_UBLAS_TEST_CHECK_EQ (a.lower_bound (scrambled (7))->first, scrambled (7));
+
+    a.erase (a.find (scrambled (7)));
+    BOOST_UBLAS_TEST_CHECK_EQ (a.size (), std::size_t (499));
+    BOOST_UBLAS_TEST_CHECK (a.find (scrambled (7)) == a.end ());
+    BOOST_UBLAS_TEST_CHECK_EQ (a.find (scrambled (8))->second, 8.0);
+
+    a.clear ();
+    BOOST_UBLAS_TEST_CHECK (a.empty ());
+    BOOST_UBLAS_TEST_CHECK (a.find (scrambled (8)) == a.end ());
+
+    // push_back compares with the largest key, not the last inserted one
+    a.insert (hash_array::value_type (5, 1.0));
+    a.insert (hash_array::value_type (1, 2.0));
+#ifndef BOOST_UBLAS_NO_EXCEPTIONS
+    bool rejected = false;
+    try {
+        a.push_back (a.end (), hash_array::value_type (5, 4.0));
+    } catch (const ublas::external_logic &) {
+        rejected = true;
+    }
+    BOOST_UBLAS_TEST_CHECK (rejected);
+    BOOST_UBLAS_TEST_CHECK_EQ (a.size (), std::size_t (2));
+#endif
+    a.push_back (a.end (), hash_array::value_type (7, 3.0));
+    BOOST_UBLAS_TEST_CHECK_EQ (a.size (), std::size_t (3));
+    BOOST_UBLAS_TEST_CHECK_EQ (a.begin ()->first, std::size_t (1));
+    BOOST_UBLAS_TEST_CHECK_EQ ((a.end () - 1)->first, std::size_t (7));
+}
+
+template<class L>
+BOOST_UBLAS_TEST_DEF ( test_finalise ) {
+    ublas::mapped_matrix<double, L, hash_array> M (size1, size2);
+    ublas::matrix<double> R (size1, size2);
+    R.clear ();
+    for (std::size_t k = 0; k < 300; ++ k) {
+        const std::size_t key = scrambled (k);
+        M (key / size2, key % size2) += 1.0 + k;
+        R (key / size2, key % size2) += 1.0 + k;
+    }
+    ublas::compressed_matrix<double, L> C (M);
+    BOOST_UBLAS_TEST_CHECK_EQ (C.nnz (), M.nnz ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C, R, size1, size2, 0.0);
+
+    ublas::compressed_matrix<double, L, 1> C1 (M);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C1, R, size1, size2, 0.0);
+
+    // empty rows at both ends
+    ublas::mapped_matrix<double, L, hash_array> E (size1, size2);
+    E (size1 / 2, size2 / 2) = 3.0;
+    ublas::compressed_matrix<double, L> CE (E);
+    BOOST_UBLAS_TEST_CHECK_EQ (CE.nnz (), std::size_t (1));
+    BOOST_UBLAS_TEST_CHECK_EQ (CE (size1 / 2, size2 / 2), 3.0);
+    BOOST_UBLAS_TEST_CHECK_EQ (CE (0, 0), 0.0);
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_array );
+    BOOST_UBLAS_TEST_DO( test_finalise<ublas::row_major> );
+    BOOST_UBLAS_TEST_DO( test_finalise<ublas::column_major> );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,177 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/ilu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+static const std::size_t nx(5);          ///< grid points per direction
+static const std::size_t n(nx * nx);     ///< size of the test matrix
+
+typedef ublas::compressed_matrix<double, ublas::row_major> sparse_matrix;
+typedef ublas::matrix<double> dense_matrix;
+
+// 5-point Laplacian on a nx x nx grid, optionally made non symmetric
+sparse_matrix laplacian (double skew) {
+    sparse_matrix A (n, n);
+    for (std::size_t i = 0; i < n; ++ i) {
+        if (i >= nx)
+            A (i, i - nx) = -1.0 - skew;
+        if (i % nx != 0)
+            A (i, i - 1) = -1.0 - skew;
+        A (i, i) = 4.0;
+        if (i % nx != nx - 1)
+            A (i, i + 1) = -1.0 + skew;
+        if (i + nx < n)
+            A (i, i + nx) = -1.0 + skew;
+    }
+    return A;
+}
+
+// split a dense copy of the factor into its lower and upper parts
+void split_factor (const sparse_matrix &m, dense_matrix &L, dense_matrix &U, bool unit_lower) {
+    dense_matrix F (m);
+    L = dense_matrix (n, n, 0.0);
+    U = dense_matrix (n, n, 0.0);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < n; ++ j) {
+            if (j < i || (j == i && ! unit_lower))
+                L (i, j) = F (i, j);
+            if (j >= i)
+                U (i, j) = F (i, j);
+        }
+    if (unit_lower)
+        L += ublas::identity_matrix<double> (n);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_ilu0 )
+{
+    const sparse_matrix A (laplacian (0.3));
+    sparse_matrix LU (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ilu0_factorize (LU), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (LU.nnz (), A.nnz ());
+
+    // L * U reproduces A on its pattern
+    dense_matrix L, U;
+    split_factor (LU, L, U, true);
+    dense_matrix P (ublas::prod (L, U));
+    for (sparse_matrix::const_iterator1 it1 = A.begin1 (); it1 != A.end1 (); ++ it1)
+        for (sparse_matrix::const_iterator2 it2 = it1.begin (); it2 != it1.end (); ++ it2)
+            BOOST_UBLAS_TEST_CHECK_CLOSE (P (it2.index1 (), it2.index2 ()), *it2, TOL);
+
+    // the level scheduled variant computes the same factor
+    sparse_matrix LU2 (A);
+    ublas::level_schedule<sparse_matrix, ublas::lower_tag> s (LU2);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ilu0_factorize (LU2, s), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LU, LU2, n, n, TOL);
+
+    // serial and scheduled application agree with dense triangular solves
+    ublas::vector<double> b (n);
+    for (std::size_t i = 0; i < n; ++ i)
+        b (i) = 1.0 + i % 3;
+    ublas::vector<double> x (b);
+    ublas::ilu_substitute (LU, x);
+    dense_matrix D (LU);
+    ublas::vector<double> y (b);
+    ublas::inplace_solve (D, y, ublas::unit_lower_tag ());
+    ublas::inplace_solve (D, y, ublas::upper_tag ());
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (x, y, n, TOL);
+
+    ublas::level_schedule<sparse_matrix, ublas::unit_lower_tag> ls (LU);
+    ublas::level_schedule<sparse_matrix, ublas::upper_tag> us (LU);
+    ublas::vector<double> z (b);
+    ublas::ilu_substitute (LU, ls, us, z);
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (z, y, n, TOL);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_ic0 )
+{
+    const sparse_matrix A (laplacian (0.0));
+    sparse_matrix LL (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ic0_factorize (LL), std::size_t (0));
+
+    // L * L^T reproduces A on its pattern and the upper triangle holds L^T
+    dense_matrix F (LL);
+    dense_matrix L, U;
+    split_factor (LL, L, U, false);
+    dense_matrix P (ublas::prod (L, ublas::trans (L)));
+    for (sparse_matrix::const_iterator1 it1 = A.begin1 (); it1 != A.end1 (); ++ it1)
+        for (sparse_matrix::const_iterator2 it2 = it1.begin (); it2 != it1.end (); ++ it2) {
+            BOOST_UBLAS_TEST_CHECK_CLOSE (P (it2.index1 (), it2.index2 ()), *it2, TOL);
+            BOOST_UBLAS_TEST_CHECK_CLOSE (F (it2.index1 (), it2.index2 ()), F (it2.index2 (), it2.index1 ()), TOL);
+        }
+
+    sparse_matrix LL2 (A);
+    ublas::level_schedule<sparse_matrix, ublas::lower_tag> s (LL2);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ic0_factorize (LL2, s), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LL, LL2, n, n, TOL);
+
+    ublas::vector<double> b (n, 1.0);
+    ublas::vector<double> x (b);
+    ublas::ic_substitute (LL, x);
+    ublas::vector<double> y (b);
+    ublas::inplace_solve (L, y, ublas::lower_tag ());
+    ublas::inplace_solve (U, y, ublas::upper_tag ());
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (x, y, n, TOL);
+
+    ublas::level_schedule<sparse_matrix, ublas::upper_tag> us (LL);
+    ublas::vector<double> z (b);
+    ublas::ic_substitute (LL, s, us, z);
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (z, y, n, TOL);
+
+    // an indefinite matrix is reported
+    sparse_matrix B (A);
+    B (3, 3) = -1.0;
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ic0_factorize (B), std::size_t (4));
+
+    // a row without a stored diagonal is reported, later rows referring to it are skipped
+    sparse_matrix C (3, 3);
+    C (0, 1) = 1.0;
+    C (1, 0) = 1.0;
+    C (1, 1) = 4.0;
+    C (2, 2) = 4.0;
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ic0_factorize (C), std::size_t (1));
+}
+
+BOOST_UBLAS_TEST_DEF ( test_ilut )
+{
+    const sparse_matrix A (laplacian (0.3));
+    ublas::vector<double> b (n);
+    for (std::size_t i = 0; i < n; ++ i)
+        b (i) = 1.0 + i % 3;
+
+    // without dropping ILUT is a complete LU factorization
+    sparse_matrix LU (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ilut_factorize (LU, 0.0, n), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK (LU.nnz () > A.nnz ());
+    ublas::vector<double> x (b);
+    ublas::ilu_substitute (LU, x);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_2 (ublas::prod (A, x) - b) < TOL);
+
+    // dropping keeps at most fill entries per triangle and row, and still preconditions
+    sparse_matrix LUt (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::ilut_factorize (LUt, 1.0e-2, 3), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK (LUt.nnz () <= 7 * n);
+    ublas::vector<double> y (b);
+    ublas::ilu_substitute (LUt, y);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_2 (ublas::prod (A, y) - b) < 0.5 * ublas::norm_2 (b));
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_ilu0 );
+    BOOST_UBLAS_TEST_DO( test_ic0 );
+    BOOST_UBLAS_TEST_DO( test_ilut );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -78,6 +78,55 @@ BOOST_UBLAS_TEST_DEF ( test_inplace_solve )
     }
 }
 
+// Many right hand sides, large enough to use several diagonal and column blocks
+template<class mat, class rhs>
+BOOST_UBLAS_TEST_DEF ( test_inplace_solve_multiple_rhs )
+{
+    const std::size_t size(150), columns(130);
+    mat A(size, size);
+    rhs B(size, columns);
+    for (std::size_t i=0; i<size; ++i) {
+        for (std::size_t j=0; j<size; ++j) {
+            A(i, j) = (i == j) ? 2.0 + double(i % 7) : 1.0 / (1.0 + i + 2 * j);
+        }
+        for (std::size_t j=0; j<columns; ++j) {
+            B(i, j) = double((i * 31 + j * 17) % 23) - 11.0;
+        }
+    }
+
+    // Every column must match the single right hand side solve
+    {
+        rhs X(B);
+        ublas::inplace_solve(A, X, ublas::lower_tag());
+        for (std::size_t j=0; j<columns; ++j) {
+            ublas::vector<double> x(ublas::column(B, j));
+            ublas::inplace_solve(A, x, ublas::lower_tag());
+            BOOST_UBLAS_TEST_CHECK(ublas::norm_inf(ublas::column(X, j) - x) < TOL);
+        }
+    }
+    {
+        rhs X(B);
+        ublas::inplace_solve(A, X, ublas::upper_tag());
+        for (std::size_t j=0; j<columns; ++j) {
+            ublas::vector<double> x(ublas::column(B, j));
+            ublas::inplace_solve(A, x, ublas::upper_tag());
+            BOOST_UBLAS_TEST_CHECK(ublas::norm_inf(ublas::column(X, j) - x) < TOL);
+        }
+    }
+    {
+        rhs X(B);
+        ublas::inplace_solve(A, X, ublas::unit_lower_tag());
+        rhs AX(ublas::prod(ublas::triangular_adaptor<mat, ublas::unit_lower>(A), X));
+        BOOST_UBLAS_TEST_CHECK(ublas::norm_inf(AX - B) < TOL);
+    }
+    {
+        rhs X(B);
+        ublas::inplace_solve(ublas::trans(A), X, ublas::upper_tag());
+        rhs AX(ublas::prod(ublas::trans(ublas::triangular_adaptor<mat, ublas::lower>(A)), X));
+        BOOST_UBLAS_TEST_CHECK(ublas::norm_inf(AX - B) < TOL);
+    }
+}
+
 int main() {
 
     // typedefs are needed as macros do not work with "," in template arguments
@@ -89,6 +138,10 @@ int main() {
     typedef ublas::matrix<double, ublas::column_major>  mat_doub_colmaj;
     BOOST_UBLAS_TEST_DO( test_inplace_solve<mat_doub_rowmaj> );
     BOOST_UBLAS_TEST_DO( test_inplace_solve<mat_doub_colmaj> );
+    BOOST_UBLAS_TEST_DO( (test_inplace_solve_multiple_rhs<mat_doub_rowmaj, mat_doub_rowmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_inplace_solve_multiple_rhs<mat_doub_rowmaj, mat_doub_colmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_inplace_solve_multiple_rhs<mat_doub_colmaj, mat_doub_rowmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_inplace_solve_multiple_rhs<mat_doub_colmaj, mat_doub_colmaj>) );
 #endif
 
 #ifdef USE_COMPRESSED_MATRIX
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+typedef ublas::matrix<double, ublas::row_major> row_matrix;
+typedef ublas::matrix<double, ublas::column_major> column_matrix;
+
+template<class M>
+M random_matrix (std::size_t size) {
+    M A (size, size);
+    for (std::size_t i = 0; i < size; ++ i)
+        for (std::size_t j = 0; j < size; ++ j)
+            A (i, j) = double (std::rand ()) / RAND_MAX - 0.5 + (i == j ? 2.0 : 0.0);
+    return A;
+}
+
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_inverse )
+{
+    const std::size_t sizes [][2] = { {150, 64}, {150, 16}, {97, 7}, {1, 64}, {20, 64} };
+    ublas::inverse_workspace<double> w;
+    for (std::size_t s = 0; s < sizeof (sizes) / sizeof (sizes [0]); ++ s) {
+        const std::size_t size = sizes [s] [0];
+        const M A (random_matrix<M> (size));
+        const ublas::identity_matrix<double> I (size);
+
+        const ublas::matrix<double> X (ublas::inverse (A));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (A, X) - I) < TOL);
+
+        // the workspace is reused across orders
+        M Y (A);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::inplace_inverse (Y, w, sizes [s] [1]), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (Y, A) - I) < TOL);
+
+        M LU (A);
+        ublas::permutation_matrix<std::size_t> pm (size);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_factorize (LU, pm), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_inverse (LU, pm, sizes [s] [1]), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (LU - Y) < TOL);
+    }
+}
+
+BOOST_UBLAS_TEST_DEF ( test_singular )
+{
+    row_matrix A (random_matrix<row_matrix> (30));
+    ublas::row (A, 17) = ublas::row (A, 3);
+    ublas::inverse_workspace<double> w;
+    row_matrix B (A);
+    BOOST_UBLAS_TEST_CHECK (ublas::inplace_inverse (B, w, 8) != std::size_t (0));
+
+    row_matrix LU (A);
+    ublas::permutation_matrix<std::size_t> pm (30);
+    if (ublas::lu_factorize (LU, pm) == 0)
+        BOOST_UBLAS_TEST_CHECK (ublas::lu_inverse (LU, pm, 8) != std::size_t (0));
+
+#ifndef BOOST_UBLAS_NO_EXCEPTIONS
+    bool thrown = false;
+    try {
+        ublas::inverse (A);
+    } catch (const ublas::singular &) {
+        thrown = true;
+    }
+    BOOST_UBLAS_TEST_CHECK (thrown);
+#endif
+    BOOST_UBLAS_TEST_CHECK (std::abs (ublas::determinant (A)) < TOL);
+
+    ublas::zero_matrix<double> Z (5, 5);
+    double sign;
+    BOOST_UBLAS_TEST_CHECK (ublas::determinant (Z) == 0.0);
+    BOOST_UBLAS_TEST_CHECK (ublas::log_abs_determinant (Z, sign) < 0.0 && sign == 0.0);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_determinant )
+{
+    // triangular factors with known determinants, rows interchanged
+    const std::size_t size = 120;
+    row_matrix L (size, size), U (size, size);
+    L.clear ();
+    U.clear ();
+    double product = 1.0;
+    for (std::size_t i = 0; i < size; ++ i) {
+        L (i, i) = 1.0;
+        U (i, i) = 0.5 + double (i % 3);
+        product *= U (i, i);
+        for (std::size_t j = 0; j < i; ++ j)
+            L (i, j) = 0.1 * (double (std::rand ()) / RAND_MAX - 0.5);
+        for (std::size_t j = i + 1; j < size; ++ j)
+            U (i, j) = double (std::rand ()) / RAND_MAX - 0.5;
+    }
+    row_matrix A (ublas::prod (L, U));
+    BOOST_UBLAS_TEST_CHECK_CLOSE (ublas::determinant (A), product, TOL);
+    ublas::row (A, 4).swap (ublas::row (A, 90));
+    BOOST_UBLAS_TEST_CHECK_CLOSE (ublas::determinant (A), - product, TOL);
+    double sign;
+    BOOST_UBLAS_TEST_CHECK_CLOSE (ublas::log_abs_determinant (A, sign), std::log (product), TOL);
+    BOOST_UBLAS_TEST_CHECK_EQ (sign, -1.0);
+
+    // beyond the range of double
+    const ublas::matrix<double> B (ublas::identity_matrix<double> (400) * 10.0);
+    BOOST_UBLAS_TEST_CHECK_CLOSE (ublas::log_abs_determinant (B), 400 * std::log (10.0), TOL);
+
+    // complex: the sign is the phase of the determinant
+    typedef std::complex<double> complex;
+    ublas::matrix<complex> C (2, 2);
+    C (0, 0) = complex (1, 1);
+    C (0, 1) = complex (2, 0);
+    C (1, 0) = complex (0, 1);
+    C (1, 1) = complex (3, -1);
+    const complex det = C (0, 0) * C (1, 1) - C (0, 1) * C (1, 0);
+    BOOST_UBLAS_TEST_CHECK (std::abs (ublas::determinant (C) - det) < TOL);
+    complex phase;
+    BOOST_UBLAS_TEST_CHECK_CLOSE (ublas::log_abs_determinant (C, phase), std::log (std::abs (det)), TOL);
+    BOOST_UBLAS_TEST_CHECK (std::abs (phase - det / std::abs (det)) < TOL);
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_inverse<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_inverse<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_singular );
+    BOOST_UBLAS_TEST_DO( test_determinant );
+
+    BOOST_UBLAS_TEST_END();
+}
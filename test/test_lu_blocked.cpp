@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// lu_factorize only checks its result for square matrices
+#define BOOST_UBLAS_TYPE_CHECK 0
+
+#include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+typedef ublas::matrix<double, ublas::row_major> row_matrix;
+typedef ublas::matrix<double, ublas::column_major> column_matrix;
+
+template<class M>
+M random_matrix (std::size_t size1, std::size_t size2) {
+    M A (size1, size2);
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = 0; j < size2; ++ j)
+            A (i, j) = double (std::rand ()) / RAND_MAX - 0.5;
+    return A;
+}
+
+// the blocked factorization must reproduce the unblocked one
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_against_unblocked )
+{
+    const std::size_t sizes [][3] = { {150, 150, 32}, {150, 150, 7}, {170, 90, 16}, {90, 170, 16}, {20, 20, 64} };
+    for (std::size_t s = 0; s < sizeof (sizes) / sizeof (sizes [0]); ++ s) {
+        const std::size_t size1 = sizes [s] [0], size2 = sizes [s] [1];
+        const M A (random_matrix<M> (size1, size2));
+        M LU1 (A), LU2 (A);
+        ublas::permutation_matrix<std::size_t> pm1 (size1), pm2 (size1);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_factorize (LU1, pm1), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_lu_factorize (LU2, pm2, sizes [s] [2]), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LU1, LU2, size1, size2, TOL);
+        for (std::size_t i = 0; i < size1; ++ i)
+            BOOST_UBLAS_TEST_CHECK_EQ (pm1 (i), pm2 (i));
+    }
+}
+
+// P A = L U and the factors can be used by lu_substitute
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_reconstruct_and_solve )
+{
+    const std::size_t n = 200;
+    const M A (random_matrix<M> (n, n));
+    M LU (A);
+    ublas::permutation_matrix<std::size_t> pm (n);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_lu_factorize (LU, pm), std::size_t (0));
+
+    const ublas::triangular_adaptor<M, ublas::unit_lower> L (LU);
+    const ublas::triangular_adaptor<M, ublas::upper> U (LU);
+    M PA (A);
+    ublas::swap_rows (pm, PA);
+    M LxU (ublas::prod (L, U));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (PA, LxU, n, n, TOL);
+
+    ublas::vector<double> x (n), b;
+    for (std::size_t i = 0; i < n; ++ i)
+        x (i) = 1.0 + double (i) / n;
+    b = ublas::prod (A, x);
+    ublas::lu_substitute (LU, pm, b);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+}
+
+// a zero column is reported like lu_factorize does
+BOOST_UBLAS_TEST_DEF ( test_singular )
+{
+    typedef ublas::matrix<double> M;
+    M A (random_matrix<M> (40, 40));
+    ublas::column (A, 21) = ublas::zero_vector<double> (40);
+    ublas::column (A, 33) = ublas::zero_vector<double> (40);
+    M LU1 (A), LU2 (A);
+    ublas::permutation_matrix<std::size_t> pm1 (40), pm2 (40);
+    const std::size_t s1 = ublas::lu_factorize (LU1, pm1);
+    const std::size_t s2 = ublas::block_lu_factorize (LU2, pm2, 8);
+    BOOST_UBLAS_TEST_CHECK_EQ (s2, std::size_t (22));
+    BOOST_UBLAS_TEST_CHECK_EQ (s1, s2);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LU1, LU2, 40, 40, TOL);
+}
+
+// refactorization with the pivots of a nearby matrix
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_refactorize )
+{
+    const std::size_t n = 150;
+    const M A (random_matrix<M> (n, n));
+    M LU (A);
+    ublas::permutation_matrix<std::size_t> pm (n);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_lu_factorize (LU, pm, 16), std::size_t (0));
+
+    // the same matrix gives the same factors
+    M LU2 (A);
+    ublas::permutation_matrix<std::size_t> pm2 (pm);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_refactorize (LU2, pm2, 10.0, 16), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (LU, LU2, n, n, TOL);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_EQ (pm (i), pm2 (i));
+
+    ublas::vector<double> x (n);
+    for (std::size_t i = 0; i < n; ++ i)
+        x (i) = 1.0 + double (i) / n;
+
+    // a slightly perturbed matrix keeps the pivots
+    const M B (A + 1.0e-3 * random_matrix<M> (n, n));
+    M LU3 (B);
+    ublas::permutation_matrix<std::size_t> pm3 (pm);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_refactorize (LU3, pm3), std::size_t (0));
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_EQ (pm (i), pm3 (i));
+    ublas::vector<double> b (ublas::prod (B, x));
+    ublas::lu_substitute (LU3, pm3, b);
+    for (std::size_t i = 0; i < n; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+
+    // a pivot made tiny falls back to the pivot search with bounded multipliers
+    M C (A);
+    ublas::swap_rows (pm, C);
+    ublas::row (C, 70) *= 1.0e-9;
+    for (std::size_t i = n; i > 0; -- i)
+        ublas::row (C, i - 1).swap (ublas::row (C, pm (i - 1)));
+    M LU4 (C);
+    ublas::permutation_matrix<std::size_t> pm4 (pm);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::lu_refactorize (LU4, pm4, 10.0, 16), std::size_t (0));
+    for (std::size_t i = 0; i < 70; ++ i)
+        BOOST_UBLAS_TEST_CHECK_EQ (pm (i), pm4 (i));
+    BOOST_UBLAS_TEST_CHECK (pm (70) != pm4 (70));
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < i; ++ j)
+            BOOST_UBLAS_TEST_CHECK (std::abs (LU4 (i, j)) <= 10.0);
+    const ublas::triangular_adaptor<M, ublas::unit_lower> L (LU4);
+    const ublas::triangular_adaptor<M, ublas::upper> U (LU4);
+    M PC (C);
+    ublas::swap_rows (pm4, PC);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (M (ublas::prod (L, U)) - PC) < TOL);
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_against_unblocked<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_against_unblocked<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_reconstruct_and_solve<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_reconstruct_and_solve<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_singular );
+    BOOST_UBLAS_TEST_DO( test_refactorize<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_refactorize<column_matrix> );
+
+    BOOST_UBLAS_TEST_END();
+}
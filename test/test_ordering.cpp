@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/ordering.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include <vector>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+static const std::size_t nx(12);   ///< grid points per direction
+static const std::size_t n(nx * nx);
+
+// grid point of row i, numbered in a scrambled order to spoil the natural bandwidth
+std::size_t scrambled (std::size_t i) {
+    return (i * 37) % n;
+}
+
+// 5 point Laplacian on the scrambled grid, plus one isolated row to give two components
+template<class mat>
+mat grid_matrix () {
+    ublas::matrix<double> D (n + 1, n + 1);
+    D.clear ();
+    for (std::size_t y = 0; y < nx; ++ y) {
+        for (std::size_t x = 0; x < nx; ++ x) {
+            const std::size_t i = scrambled (y * nx + x);
+            D (i, i) = 4.0;
+            if (x > 0) D (i, scrambled (y * nx + x - 1)) = -1.0 - 0.01 * i;
+            if (x + 1 < nx) D (i, scrambled (y * nx + x + 1)) = -1.0 + 0.01 * i;
+            if (y > 0) D (i, scrambled ((y - 1) * nx + x)) = -1.0;
+            if (y + 1 < nx) D (i, scrambled ((y + 1) * nx + x)) = -1.5;
+        }
+    }
+    D (n, n) = 2.0;
+    return mat (D);
+}
+
+template<class PM>
+bool is_permutation (const PM &pm) {
+    std::vector<bool> seen (pm.size (), false);
+    for (std::size_t i = 0; i < pm.size (); ++ i) {
+        if (pm (i) >= pm.size () || seen [pm (i)])
+            return false;
+        seen [pm (i)] = true;
+    }
+    return true;
+}
+
+// number of fill entries of a symbolic Cholesky factorization in the given order
+template<class mat, class PM>
+std::size_t fill_in (const mat &A, const PM &pm) {
+    const std::size_t size = A.size1 ();
+    std::vector<std::vector<bool> > G (size, std::vector<bool> (size, false));
+    for (std::size_t i = 0; i < size; ++ i)
+        for (std::size_t j = 0; j < size; ++ j)
+            G [i][j] = A.find_element (pm (i), pm (j)) != 0 || A.find_element (pm (j), pm (i)) != 0;
+    std::size_t fill = 0;
+    for (std::size_t k = 0; k < size; ++ k)
+        for (std::size_t i = k + 1; i < size; ++ i)
+            if (G [i][k])
+                for (std::size_t j = k + 1; j < size; ++ j)
+                    if (G [j][k] && ! G [i][j]) {
+                        G [i][j] = true;
+                        ++ fill;
+                    }
+    return fill;
+}
+
+template<class mat, class PM>
+bool check_permuted (const mat &A, const PM &pm, const mat &B) {
+    if (B.nnz () != A.nnz ())
+        return false;
+    for (std::size_t i = 0; i < A.size1 (); ++ i)
+        for (std::size_t j = 0; j < A.size2 (); ++ j)
+            if (B (i, j) != A (pm (i), pm (j)))
+                return false;
+    return true;
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_rcm ) {
+    const mat A (grid_matrix<mat> ());
+    const ublas::permutation_matrix<std::size_t> pm (ublas::reverse_cuthill_mckee (A));
+    BOOST_UBLAS_TEST_CHECK_EQ (pm.size (), n + 1);
+    BOOST_UBLAS_TEST_CHECK (is_permutation (pm));
+
+    const mat B (ublas::symmetric_permute (A, pm));
+    BOOST_UBLAS_TEST_CHECK (check_permuted (A, pm, B));
+    BOOST_UBLAS_TEST_CHECK (ublas::bandwidth (A) > 2 * nx);
+    BOOST_UBLAS_TEST_CHECK (ublas::bandwidth (B) <= nx + 1);
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_nested_dissection ) {
+    const mat A (grid_matrix<mat> ());
+    const ublas::permutation_matrix<std::size_t> pm (ublas::nested_dissection (A, 4));
+    BOOST_UBLAS_TEST_CHECK_EQ (pm.size (), n + 1);
+    BOOST_UBLAS_TEST_CHECK (is_permutation (pm));
+
+    mat B;
+    ublas::symmetric_permute (A, pm, B);
+    BOOST_UBLAS_TEST_CHECK (check_permuted (A, pm, B));
+
+    const ublas::permutation_matrix<std::size_t> rcm (ublas::reverse_cuthill_mckee (A));
+    BOOST_UBLAS_TEST_CHECK (fill_in (A, pm) < fill_in (A, rcm));
+}
+
+int main () {
+    typedef ublas::compressed_matrix<double, ublas::row_major> commat_doub_rowmaj;
+    typedef ublas::compressed_matrix<double, ublas::column_major> commat_doub_colmaj;
+    typedef ublas::compressed_matrix<double, ublas::row_major, 1> commat_doub_rowmaj_1;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_rcm<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_rcm<commat_doub_colmaj> );
+    BOOST_UBLAS_TEST_DO( test_rcm<commat_doub_rowmaj_1> );
+    BOOST_UBLAS_TEST_DO( test_nested_dissection<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_nested_dissection<commat_doub_colmaj> );
+    BOOST_UBLAS_TEST_DO( test_nested_dissection<commat_doub_rowmaj_1> );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/blas.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/hermitian.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <complex>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+static const std::size_t n(97);          ///< size of the packed matrices
+static const std::size_t k(70);          ///< columns of the right hand sides
+
+typedef std::complex<double> complex_type;
+
+double value (std::size_t i, std::size_t j, double) {
+    return 1.0 / (1.0 + i + j) + ((i * 7 + j * 3) % 5);
+}
+complex_type value (std::size_t i, std::size_t j, complex_type) {
+    return complex_type (value (i, j, 0.0), double ((i * 5 + j * 11) % 7) - 3.0);
+}
+
+// dense symmetric (or hermitian) matrix holding the same elements as the packed one
+template<class T>
+ublas::matrix<T> dense_matrix (bool hermitian) {
+    ublas::matrix<T> A (n, n);
+    for (std::size_t i = 0; i < n; ++ i) {
+        for (std::size_t j = 0; j < i; ++ j) {
+            A (i, j) = value (i, j, T ());
+            A (j, i) = hermitian ? ublas::type_traits<T>::conj (A (i, j)) : A (i, j);
+        }
+        A (i, i) = ublas::type_traits<T>::real (value (i, i, T ()));
+    }
+    return A;
+}
+
+template<class T>
+ublas::matrix<T> dense_rhs (std::size_t size1, std::size_t size2) {
+    ublas::matrix<T> B (size1, size2);
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = 0; j < size2; ++ j)
+            B (i, j) = value (j, i + 3, T ());
+    return B;
+}
+
+template<class T, class TRI, class L>
+bool is_hermitian (const ublas::symmetric_matrix<T, TRI, L> &) {
+    return false;
+}
+template<class T, class TRI, class L>
+bool is_hermitian (const ublas::hermitian_matrix<T, TRI, L> &) {
+    return true;
+}
+
+// Products with the packed matrix agree with the dense ones
+template<class P>
+BOOST_UBLAS_TEST_DEF ( test_packed_products )
+{
+    typedef typename P::value_type value_type;
+    typedef ublas::matrix<value_type> dense_type;
+
+    const dense_type D (dense_matrix<value_type> (is_hermitian (P ())));
+    const P A (D);
+
+    ublas::vector<value_type> x (n), y (n, value_type (1));
+    for (std::size_t i = 0; i < n; ++ i)
+        x (i) = value (i, 2 * i, value_type ());
+    ublas::axpy_prod (A, x, y, true);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (y - ublas::prod (D, x)) < TOL);
+    ublas::axpy_prod (A, x, y, false);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (y - 2.0 * ublas::prod (D, x)) < TOL);
+
+    const dense_type B (dense_rhs<value_type> (n, k));
+    dense_type C (n, k);
+    ublas::axpy_prod (A, B, C, true);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (C - ublas::prod (D, B)) < TOL);
+    ublas::matrix<value_type, ublas::column_major> Cc (n, k);
+    ublas::axpy_prod (A, B, Cc, true);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (Cc - ublas::prod (D, B)) < TOL);
+}
+
+// Rank k updates computed directly into the packed triangle
+template<class T, class TRI, class L>
+BOOST_UBLAS_TEST_DEF ( test_packed_rank_k )
+{
+    typedef ublas::matrix<T> dense_type;
+
+    const dense_type B (dense_rhs<T> (n, k));
+    {
+        ublas::symmetric_matrix<T, TRI, L> S (dense_matrix<T> (false));
+        dense_type R (2.0 * S + 0.5 * dense_type (ublas::prod (B, ublas::trans (B))));
+        ublas::blas_3::srk (S, 2.0, 0.5, B);
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (S - R) < TOL * n);
+    }
+    {
+        ublas::hermitian_matrix<T, TRI, L> H (dense_matrix<T> (true));
+        dense_type R (2.0 * H + 0.5 * dense_type (ublas::prod (B, ublas::herm (B))));
+        ublas::blas_3::hrk (H, 2.0, 0.5, B);
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (H - R) < TOL * n);
+    }
+}
+
+int main () {
+    typedef ublas::symmetric_matrix<double, ublas::lower, ublas::row_major> sym_lower_row;
+    typedef ublas::symmetric_matrix<double, ublas::lower, ublas::column_major> sym_lower_column;
+    typedef ublas::symmetric_matrix<double, ublas::upper, ublas::row_major> sym_upper_row;
+    typedef ublas::symmetric_matrix<double, ublas::upper, ublas::column_major> sym_upper_column;
+    typedef ublas::hermitian_matrix<complex_type, ublas::lower, ublas::row_major> herm_lower_row;
+    typedef ublas::hermitian_matrix<complex_type, ublas::lower, ublas::column_major> herm_lower_column;
+    typedef ublas::hermitian_matrix<complex_type, ublas::upper, ublas::row_major> herm_upper_row;
+    typedef ublas::hermitian_matrix<complex_type, ublas::upper, ublas::column_major> herm_upper_column;
+    typedef ublas::symmetric_matrix<double, ublas::lower, ublas::rfp_row_major> sym_lower_rfp_row;
+    typedef ublas::symmetric_matrix<double, ublas::lower, ublas::rfp_column_major> sym_lower_rfp_column;
+    typedef ublas::symmetric_matrix<double, ublas::upper, ublas::rfp_row_major> sym_upper_rfp_row;
+    typedef ublas::symmetric_matrix<double, ublas::upper, ublas::rfp_column_major> sym_upper_rfp_column;
+    typedef ublas::hermitian_matrix<complex_type, ublas::lower, ublas::rfp_row_major> herm_lower_rfp_row;
+    typedef ublas::hermitian_matrix<complex_type, ublas::upper, ublas::rfp_column_major> herm_upper_rfp_column;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_lower_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_lower_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_upper_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_upper_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_lower_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_lower_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_upper_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_upper_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_lower_rfp_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_lower_rfp_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_upper_rfp_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<sym_upper_rfp_column> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_lower_rfp_row> );
+    BOOST_UBLAS_TEST_DO( test_packed_products<herm_upper_rfp_column> );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<double, ublas::lower, ublas::row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<double, ublas::upper, ublas::column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<complex_type, ublas::lower, ublas::column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<complex_type, ublas::upper, ublas::row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<double, ublas::lower, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<double, ublas::lower, ublas::rfp_row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<double, ublas::upper, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_packed_rank_k<complex_type, ublas::upper, ublas::rfp_row_major>) );
+
+    BOOST_UBLAS_TEST_END();
+}
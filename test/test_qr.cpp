@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/qr.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+double random_value () {
+    return double (std::rand ()) / RAND_MAX - 0.5;
+}
+
+template<class M>
+M random_matrix (std::size_t size1, std::size_t size2) {
+    M A (size1, size2);
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = 0; j < size2; ++ j)
+            A (i, j) = random_value ();
+    return A;
+}
+
+// R from the upper triangle of the factors
+template<class M>
+ublas::matrix<double> upper_part (const M &QR, std::size_t size1) {
+    ublas::matrix<double> R (size1, QR.size2 ());
+    for (std::size_t i = 0; i < size1; ++ i)
+        for (std::size_t j = 0; j < QR.size2 (); ++ j)
+            R (i, j) = i <= j && i < QR.size1 () ? QR (i, j) : 0.0;
+    return R;
+}
+
+// Q R = A and Q' Q = I, for the economy and the full Q
+template<class M>
+void check_factors (std::size_t size1, std::size_t size2, std::size_t block_size, std::size_t &test_fails__) {
+    M A (random_matrix<M> (size1, size2));
+    if (size2 > 5)
+        ublas::column (A, 5) = ublas::zero_vector<double> (size1);
+    M QR (A);
+    const std::size_t size = (std::min) (size1, size2);
+    ublas::vector<double> tau (size);
+    ublas::qr_factorize (QR, tau, block_size);
+
+    M Q (size1, size);
+    ublas::qr_form_q (QR, tau, Q, block_size);
+    const ublas::matrix<double> QtQ (ublas::prod (ublas::trans (Q), Q));
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (QtQ - ublas::identity_matrix<double> (size)) < TOL);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (Q, upper_part (QR, size)) - A) < TOL);
+
+    M F (size1, size1);
+    ublas::qr_form_q (QR, tau, F, block_size);
+    const ublas::matrix<double> FtF (ublas::prod (ublas::trans (F), F));
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (FtF - ublas::identity_matrix<double> (size1)) < TOL);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (F, upper_part (QR, size1)) - A) < TOL);
+}
+
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_qr_factors )
+{
+    check_factors<M> (200, 90, 16, test_fails__);
+    check_factors<M> (150, 150, 32, test_fails__);
+    check_factors<M> (60, 100, 7, test_fails__);
+    check_factors<M> (40, 30, 64, test_fails__);
+}
+
+// Entries whose squares overflow or underflow still factor accurately
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_qr_scaling )
+{
+    const std::size_t size1 = 50, size2 = 20;
+    const double scales[] = { 1.0e154, 1.0e300, 1.0e-160 };
+    for (std::size_t s = 0; s < 3; ++ s) {
+        const M A (random_matrix<M> (size1, size2) * scales [s]);
+        M QR (A);
+        ublas::vector<double> tau (size2);
+        ublas::qr_factorize (QR, tau, 8);
+
+        M Q (size1, size2);
+        ublas::qr_form_q (QR, tau, Q, 8);
+        const ublas::matrix<double> QtQ (ublas::prod (ublas::trans (Q), Q));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (QtQ - ublas::identity_matrix<double> (size2)) < TOL);
+        const ublas::matrix<double> R (upper_part (QR, size2) / scales [s]);
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (Q, R) - A / scales [s]) < TOL);
+    }
+}
+
+// The least squares residual is orthogonal to the columns of A
+template<class M>
+BOOST_UBLAS_TEST_DEF ( test_qr_solve )
+{
+    const std::size_t size1 = 1000, size2 = 70;
+    const M A (random_matrix<M> (size1, size2));
+    M QR (A);
+    ublas::vector<double> tau (size2);
+    ublas::qr_factorize (QR, tau);
+
+    ublas::vector<double> x (size2);
+    for (std::size_t i = 0; i < size2; ++ i)
+        x (i) = 1.0 + double (i) / size2;
+    ublas::vector<double> b (ublas::prod (A, x));
+    ublas::qr_solve (QR, tau, b);
+    for (std::size_t i = 0; i < size2; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+
+    const ublas::vector<double> c (ublas::column (random_matrix<M> (size1, 1), 0));
+    ublas::vector<double> y (c);
+    ublas::qr_solve (QR, tau, y);
+    const ublas::vector<double> r (ublas::prod (A, ublas::project (y, ublas::range (0, size2))) - c);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::prod (ublas::trans (A), r)) < TOL);
+    // the tail of Q' b carries the residual norm
+    const double tail = ublas::norm_2 (ublas::project (y, ublas::range (size2, size1)));
+    BOOST_UBLAS_TEST_CHECK_CLOSE (tail, ublas::norm_2 (r), TOL);
+
+    // several right hand sides
+    M B (size1, 3);
+    for (std::size_t j = 0; j < 3; ++ j)
+        ublas::column (B, j) = ublas::prod (A, x * double (j + 1));
+    ublas::qr_solve (QR, tau, B);
+    for (std::size_t j = 0; j < 3; ++ j)
+        for (std::size_t i = 0; i < size2; ++ i)
+            BOOST_UBLAS_TEST_CHECK_CLOSE (B (i, j), x (i) * double (j + 1), TOL);
+}
+
+int main () {
+    typedef ublas::matrix<double, ublas::row_major> row_matrix;
+    typedef ublas::matrix<double, ublas::column_major> column_matrix;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_qr_factors<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_qr_factors<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_qr_scaling<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_qr_scaling<column_matrix> );
+    BOOST_UBLAS_TEST_DO( test_qr_solve<row_matrix> );
+    BOOST_UBLAS_TEST_DO( test_qr_solve<column_matrix> );
+
+    BOOST_UBLAS_TEST_END();
+}
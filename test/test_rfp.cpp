@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/cholesky.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/hermitian.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <complex>
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+// A = B * trans (B) + n * I
+ublas::matrix<double> spd_matrix (std::size_t n) {
+    ublas::matrix<double> B (n, n);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < n; ++ j)
+            B (i, j) = double (std::rand ()) / RAND_MAX - 0.5;
+    ublas::matrix<double> A (ublas::prod (B, ublas::trans (B)));
+    for (std::size_t i = 0; i < n; ++ i)
+        A (i, i) += n;
+    return A;
+}
+
+// Every element of the triangle has its own place in the n * (n + 1) / 2 elements
+template<class M, class TRI>
+BOOST_UBLAS_TEST_DEF ( test_rfp_layout )
+{
+    typedef typename M::value_type value_type;
+
+    for (std::size_t n = 1; n < 12; ++ n) {
+        ublas::matrix<value_type> D (n, n);
+        M P (n, n);
+        // unit triangles store the strict triangle, a triangle of order n - 1
+        const std::size_t m = TRI::one (0, 0) ? n - 1 : n;
+        BOOST_UBLAS_TEST_CHECK_EQ (P.data ().size (), m * (m + 1) / 2);
+        for (std::size_t i = 0; i < n; ++ i) {
+            for (std::size_t j = 0; j < n; ++ j) {
+                D (i, j) = value_type (double (1 + i * n + j));
+                if (TRI::other (i, j))
+                    P (i, j) = D (i, j);
+            }
+        }
+        for (std::size_t i = 0; i < n; ++ i)
+            for (std::size_t j = 0; j < n; ++ j)
+                if (TRI::other (i, j))
+                    BOOST_UBLAS_TEST_CHECK (P (i, j) == D (i, j));
+    }
+}
+
+// The blocked triangular solve with many right hand sides
+template<class TRI, class L>
+BOOST_UBLAS_TEST_DEF ( test_rfp_solve )
+{
+    for (std::size_t n = 100; n < 102; ++ n) {
+        ublas::matrix<double> D (n, n, 0.0);
+        for (std::size_t i = 0; i < n; ++ i)
+            for (std::size_t j = 0; j < n; ++ j)
+                if (TRI::other (i, j))
+                    D (i, j) = i == j ? 2.0 * n : double (std::rand ()) / RAND_MAX - 0.5;
+        const ublas::triangular_matrix<double, TRI, L> T (D);
+
+        ublas::matrix<double> B (n, 37), X (n, 37);
+        for (std::size_t i = 0; i < n; ++ i)
+            for (std::size_t j = 0; j < 37; ++ j)
+                B (i, j) = 1.0 + double (i + 2 * j) / n;
+        X = B;
+        ublas::inplace_solve (T, X, typename TRI::triangular_type ());
+        ublas::matrix<double> R (ublas::prod (D, X));
+        BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (R, B, n, 37, TOL);
+    }
+}
+
+// The factor of the tiled factorization in RFP storage agrees with the dense one
+template<class TRI, class L>
+BOOST_UBLAS_TEST_DEF ( test_rfp_cholesky )
+{
+    typedef ublas::symmetric_matrix<double, TRI, L> rfp_type;
+
+    for (std::size_t n = 150; n < 152; ++ n) {
+        const ublas::matrix<double> A (spd_matrix (n));
+        ublas::matrix<double> C (A);
+        rfp_type S (A);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::cholesky_factorize (C), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (S, 32), std::size_t (0));
+        for (std::size_t i = 0; i < n; ++ i)
+            for (std::size_t j = 0; j <= i; ++ j)
+                BOOST_UBLAS_TEST_CHECK (std::abs (S (i, j) - C (i, j)) < TOL);
+
+        // not positive definite in the leading and in the trailing triangle
+        ublas::matrix<double> E (A);
+        E (37, 37) = -1.0;
+        rfp_type S1 (E);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (S1, 32), std::size_t (38));
+        E = A;
+        E (120, 120) = -1.0;
+        rfp_type S2 (E);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::block_cholesky_factorize (S2, 32), std::size_t (121));
+    }
+}
+
+int main () {
+    typedef ublas::triangular_matrix<double, ublas::lower, ublas::rfp_column_major> tri_lower_column;
+    typedef ublas::triangular_matrix<double, ublas::upper, ublas::rfp_row_major> tri_upper_row;
+    typedef ublas::triangular_matrix<double, ublas::unit_lower, ublas::rfp_row_major> tri_unit_lower_row;
+    typedef ublas::symmetric_matrix<double, ublas::lower, ublas::rfp_row_major> sym_lower_row;
+    typedef ublas::symmetric_matrix<double, ublas::upper, ublas::rfp_column_major> sym_upper_column;
+    typedef ublas::hermitian_matrix<std::complex<double>, ublas::lower, ublas::rfp_column_major> herm_lower_column;
+    typedef ublas::hermitian_matrix<std::complex<double>, ublas::upper, ublas::rfp_row_major> herm_upper_row;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<tri_lower_column, ublas::lower>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<tri_upper_row, ublas::upper>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<tri_unit_lower_row, ublas::unit_lower>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<sym_lower_row, ublas::lower>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<sym_upper_column, ublas::upper>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<herm_lower_column, ublas::lower>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_layout<herm_upper_row, ublas::upper>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_solve<ublas::lower, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_solve<ublas::lower, ublas::rfp_row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_solve<ublas::upper, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_solve<ublas::upper, ublas::rfp_row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_cholesky<ublas::lower, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_cholesky<ublas::lower, ublas::rfp_row_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_cholesky<ublas::upper, ublas::rfp_column_major>) );
+    BOOST_UBLAS_TEST_DO( (test_rfp_cholesky<ublas::upper, ublas::rfp_row_major>) );
+
+    BOOST_UBLAS_TEST_END();
+}
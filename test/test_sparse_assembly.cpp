@@ -0,0 +1,121 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/sparse_assembly.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-12);
+static const std::size_t n_nodes(7);     ///< nodes of the 2D strip mesh
+static const std::size_t n_elements(5);  ///< triangles of the strip mesh
+
+// triangles of a strip: (0,1,2), (1,3,2), (2,3,4), (3,5,4), (4,5,6)
+static const std::size_t dofs[] = { 0, 1, 2,  1, 3, 2,  2, 3, 4,  3, 5, 4,  4, 5, 6 };
+
+// element matrices stored back to back, entry (e, a, b) at (e * 3 + a) * 3 + b
+void fill_element_values (ublas::unbounded_array<double> &ev, double step) {
+    for (std::size_t e = 0; e < n_elements; ++ e)
+        for (std::size_t a = 0; a < 3; ++ a)
+            for (std::size_t b = 0; b < 3; ++ b)
+                ev [(e * 3 + a) * 3 + b] = (a == b ? 2.0 : -1.0) * (e + 1) + step * (a + 3 * b);
+}
+
+ublas::matrix<double> reference_assembly (const ublas::unbounded_array<double> &ev) {
+    ublas::matrix<double> A (n_nodes, n_nodes);
+    A.clear ();
+    for (std::size_t e = 0; e < n_elements; ++ e)
+        for (std::size_t a = 0; a < 3; ++ a)
+            for (std::size_t b = 0; b < 3; ++ b)
+                A (dofs [e * 3 + a], dofs [e * 3 + b]) += ev [(e * 3 + a) * 3 + b];
+    return A;
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_pattern )
+{
+    mat A;
+    ublas::compressed_pattern (A, n_nodes, n_nodes, n_elements, 3, dofs);
+
+    // 7 diagonal entries and 11 distinct edges in both directions
+    BOOST_UBLAS_TEST_CHECK_EQ (A.nnz (), std::size_t (7 + 2 * 11));
+    BOOST_UBLAS_TEST_CHECK (A.find_element (0, 2) != 0);
+    BOOST_UBLAS_TEST_CHECK (A.find_element (0, 3) == 0);
+    BOOST_UBLAS_TEST_CHECK (A.find_element (6, 5) != 0);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_frobenius (A) == 0.0);
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_refill )
+{
+    mat A;
+    ublas::compressed_pattern (A, n_nodes, n_nodes, n_elements, 3, dofs);
+    ublas::compressed_scatter_map<mat> map (A, n_elements, 3, dofs);
+    BOOST_UBLAS_TEST_CHECK_EQ (map.value_size (), A.nnz ());
+    BOOST_UBLAS_TEST_CHECK_EQ (map.local_size (), n_elements * 9);
+
+    const std::size_t nnz = A.nnz ();
+    const double *values = &A.value_data () [0];
+
+    ublas::unbounded_array<double> ev (n_elements * 9);
+    for (int step = 0; step < 3; ++ step) {
+        fill_element_values (ev, step);
+        ublas::refill (A, map, ev);
+        ublas::matrix<double> R (reference_assembly (ev));
+        BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (A, R, n_nodes, n_nodes, TOL);
+    }
+    // pattern and storage are untouched by refilling
+    BOOST_UBLAS_TEST_CHECK_EQ (A.nnz (), nnz);
+    BOOST_UBLAS_TEST_CHECK (&A.value_data () [0] == values);
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_scatter_add )
+{
+    mat A;
+    ublas::compressed_pattern (A, n_nodes, n_nodes, n_elements, 3, dofs);
+    ublas::compressed_scatter_map<mat> map (A, n_elements, 3, dofs);
+
+    ublas::unbounded_array<double> ev (n_elements * 9);
+    fill_element_values (ev, 1.0);
+    ublas::refill (A, map, ev);
+    ublas::zero_values (A);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_frobenius (A) == 0.0);
+
+    for (std::size_t e = 0; e < n_elements; ++ e) {
+        ublas::matrix<double> ke (3, 3);
+        for (std::size_t a = 0; a < 3; ++ a)
+            for (std::size_t b = 0; b < 3; ++ b)
+                ke (a, b) = ev [(e * 3 + a) * 3 + b];
+        ublas::scatter_add (A, map, e, ke);
+    }
+    ublas::matrix<double> R (reference_assembly (ev));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (A, R, n_nodes, n_nodes, TOL);
+}
+
+int main () {
+
+    // typedefs are needed as macros do not work with "," in template arguments
+    typedef ublas::compressed_matrix<double, ublas::row_major>        commat_doub_rowmaj;
+    typedef ublas::compressed_matrix<double, ublas::column_major>     commat_doub_colmaj;
+    typedef ublas::compressed_matrix<double, ublas::row_major, 1>     commat_doub_rowmaj_1;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_pattern<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_pattern<commat_doub_colmaj> );
+    BOOST_UBLAS_TEST_DO( test_pattern<commat_doub_rowmaj_1> );
+    BOOST_UBLAS_TEST_DO( test_refill<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_refill<commat_doub_colmaj> );
+    BOOST_UBLAS_TEST_DO( test_refill<commat_doub_rowmaj_1> );
+    BOOST_UBLAS_TEST_DO( test_scatter_add<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_scatter_add<commat_doub_colmaj> );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+static const std::size_t size1(1500);
+static const std::size_t size2(120);
+static const std::size_t rhs(130);   ///< spans several column blocks
+
+// about eight elements per row, more in the first rows to unbalance a split by rows
+ublas::matrix<double> sparse_pattern () {
+    ublas::matrix<double> A (size1, size2);
+    A.clear ();
+    for (std::size_t i = 0; i < size1; ++ i) {
+        const std::size_t count = i < 100 ? 40 : 8;
+        for (std::size_t k = 0; k < count; ++ k) {
+            const std::size_t j = (i * 31 + k * 17) % size2;
+            A (i, j) = 1.0 + double ((i + 3 * j) % 7) - 0.5 * k;
+        }
+    }
+    return A;
+}
+
+template<class dense>
+dense dense_matrix (std::size_t rows, std::size_t cols) {
+    dense B (rows, cols);
+    for (std::size_t i = 0; i < rows; ++ i)
+        for (std::size_t j = 0; j < cols; ++ j)
+            B (i, j) = double ((i * 13 + j * 7) % 11) - 5.0;
+    return B;
+}
+
+template<class mat, class dense>
+BOOST_UBLAS_TEST_DEF ( test_spmm ) {
+    const ublas::matrix<double> D (sparse_pattern ());
+    const mat A (D);
+    const dense B (dense_matrix<dense> (size2, rhs));
+    const ublas::matrix<double> R (ublas::prod (D, B));
+
+    dense C (size1, rhs);
+    ublas::axpy_prod (A, B, C, true);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C, R, size1, rhs, TOL);
+
+    // accumulate into the previous result
+    ublas::axpy_prod (A, B, C, false);
+    const ublas::matrix<double> R2 (2.0 * R);
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C, R2, size1, rhs, TOL);
+
+    // a single right hand side column
+    const dense b (dense_matrix<dense> (size2, 1));
+    dense c (size1, 1);
+    ublas::axpy_prod (A, b, c);
+    const ublas::matrix<double> r (ublas::prod (D, b));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (c, r, size1, 1, TOL);
+}
+
+// sparse results keep the generic sparse product and its fill
+BOOST_UBLAS_TEST_DEF ( test_spmm_sparse_result ) {
+    typedef ublas::compressed_matrix<double, ublas::row_major> commat;
+    const std::size_t n (300);
+    commat D (n, n), P (n, n);
+    for (std::size_t i = 0; i < n; ++ i) {
+        D.insert_element (i, i, 1.0 + double (i));
+        P.insert_element (i, (i * 7 + 3) % n, 1.0);
+    }
+    commat C (n, n);
+    ublas::axpy_prod (D, P, C, true);
+    BOOST_UBLAS_TEST_CHECK (C.nnz () == n);
+    const ublas::matrix<double> R (ublas::prod (ublas::matrix<double> (D), ublas::matrix<double> (P)));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C, R, n, n, TOL);
+}
+
+int main () {
+    typedef ublas::compressed_matrix<double, ublas::row_major> commat_doub_rowmaj;
+    typedef ublas::compressed_matrix<double, ublas::column_major> commat_doub_colmaj;
+    typedef ublas::compressed_matrix<double, ublas::row_major, 1> commat_doub_rowmaj_1;
+    typedef ublas::matrix<double, ublas::row_major> mat_doub_rowmaj;
+    typedef ublas::matrix<double, ublas::column_major> mat_doub_colmaj;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( (test_spmm<commat_doub_rowmaj, mat_doub_rowmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_spmm<commat_doub_rowmaj, mat_doub_colmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_spmm<commat_doub_colmaj, mat_doub_rowmaj>) );
+    BOOST_UBLAS_TEST_DO( (test_spmm<commat_doub_rowmaj_1, mat_doub_rowmaj>) );
+    BOOST_UBLAS_TEST_DO( test_spmm_sparse_result );
+
+    BOOST_UBLAS_TEST_END();
+}
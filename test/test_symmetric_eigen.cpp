@@ -0,0 +1,194 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/symmetric_eigen.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+double random_value () {
+    return double (std::rand ()) / RAND_MAX - 0.5;
+}
+
+ublas::matrix<double> random_symmetric (std::size_t size) {
+    ublas::matrix<double> A (size, size);
+    for (std::size_t i = 0; i < size; ++ i)
+        for (std::size_t j = 0; j <= i; ++ j)
+            A (i, j) = A (j, i) = random_value ();
+    return A;
+}
+
+// Q diag (lambda) Q' for a random orthogonal Q
+ublas::matrix<double> with_eigenvalues (const ublas::vector<double> &lambda) {
+    const std::size_t size = lambda.size ();
+    ublas::matrix<double> QR (size, size);
+    for (std::size_t i = 0; i < size; ++ i)
+        for (std::size_t j = 0; j < size; ++ j)
+            QR (i, j) = random_value ();
+    ublas::vector<double> tau (size);
+    ublas::qr_factorize (QR, tau);
+    ublas::matrix<double> Q (size, size);
+    ublas::qr_form_q (QR, tau, Q);
+    ublas::matrix<double> QL (Q);
+    for (std::size_t j = 0; j < size; ++ j)
+        ublas::column (QL, j) *= lambda (j);
+    return ublas::prod (QL, ublas::trans (Q));
+}
+
+// A Z = Z diag (w) and Z' Z = I
+template<class M, class V, class MZ>
+void check_pairs (const M &A, const V &w, const MZ &Z, std::size_t &test_fails__) {
+    const double scale = ublas::norm_inf (A) + 1.0;
+    ublas::matrix<double> ZW (Z);
+    for (std::size_t j = 0; j < w.size (); ++ j)
+        ublas::column (ZW, j) *= w (j);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ublas::matrix<double> (ublas::prod (A, Z)) - ZW) < TOL * scale);
+    const ublas::matrix<double> ZtZ (ublas::prod (ublas::trans (Z), Z));
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (ZtZ - ublas::identity_matrix<double> (w.size ())) < TOL);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_tridiagonal )
+{
+    // random, and Wilkinson's W21+ glued into a matrix of close eigenvalue pairs
+    for (std::size_t t = 0; t < 2; ++ t) {
+        const std::size_t size = 315;
+        ublas::vector<double> d (size), e (size - 1);
+        for (std::size_t i = 0; i < size; ++ i) {
+            d (i) = t == 0 ? random_value () : std::abs (double (i % 21) - 10.0);
+            if (i + 1 < size)
+                e (i) = t == 0 ? random_value () : ((i + 1) % 21 == 0 ? 1.0e-8 : 1.0);
+        }
+        ublas::matrix<double> T (ublas::zero_matrix<double> (size, size));
+        for (std::size_t i = 0; i < size; ++ i) {
+            T (i, i) = d (i);
+            if (i + 1 < size)
+                T (i + 1, i) = T (i, i + 1) = e (i);
+        }
+
+        ublas::vector<double> w (d), v (d);
+        ublas::matrix<double> Z (size, size);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_eigen (w, e, Z), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_eigen (v, e), std::size_t (0));
+        check_pairs (T, w, Z, test_fails__);
+        for (std::size_t i = 0; i < size; ++ i) {
+            BOOST_UBLAS_TEST_CHECK (std::abs (w (i) - v (i)) < TOL);
+            if (i > 0)
+                BOOST_UBLAS_TEST_CHECK (w (i - 1) <= w (i));
+        }
+    }
+}
+
+BOOST_UBLAS_TEST_DEF ( test_dense )
+{
+    const std::size_t sizes [][2] = { {200, 32}, {101, 7}, {30, 64}, {1, 32}, {2, 32} };
+    for (std::size_t s = 0; s < sizeof (sizes) / sizeof (sizes [0]); ++ s) {
+        const std::size_t size = sizes [s] [0];
+        const ublas::matrix<double> A (random_symmetric (size));
+        ublas::vector<double> w (size), v (size);
+        ublas::matrix<double> Z (size, size);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (A, w, Z, sizes [s] [1]), std::size_t (0));
+        check_pairs (A, w, Z, test_fails__);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (A, v), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (w - v) < TOL);
+    }
+
+    // packed storage, both triangles
+    const std::size_t size = 120;
+    const ublas::matrix<double> A (random_symmetric (size));
+    const ublas::symmetric_matrix<double, ublas::lower> L (A);
+    const ublas::symmetric_matrix<double, ublas::upper, ublas::column_major> U (A);
+    ublas::vector<double> w (size), wl (size), wu (size);
+    ublas::matrix<double> Z (size, size), ZL (size, size);
+    ublas::matrix<double, ublas::column_major> ZU (size, size);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (A, w, Z), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (L, wl, ZL), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (U, wu, ZU), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (w - wl) < TOL);
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (w - wu) < TOL);
+    check_pairs (A, wu, ZU, test_fails__);
+}
+
+// repeated eigenvalues deflate in the merges
+BOOST_UBLAS_TEST_DEF ( test_multiple )
+{
+    const std::size_t size = 160;
+    ublas::vector<double> lambda (size);
+    for (std::size_t i = 0; i < size; ++ i)
+        lambda (i) = double (i % 4);
+    const ublas::matrix<double> A (with_eigenvalues (lambda));
+    ublas::vector<double> w (size);
+    ublas::matrix<double> Z (size, size);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (A, w, Z), std::size_t (0));
+    check_pairs (A, w, Z, test_fails__);
+    for (std::size_t i = 0; i < size; ++ i)
+        BOOST_UBLAS_TEST_CHECK (std::abs (w (i) - double (i / 40)) < TOL);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_largest )
+{
+    const std::size_t size = 180, count = 12;
+    const ublas::matrix<double> A (random_symmetric (size));
+    ublas::vector<double> all (size);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::symmetric_eigen (A, all), std::size_t (0));
+    ublas::vector<double> w (count);
+    ublas::matrix<double> Z (size, count);
+    ublas::symmetric_eigen_largest (A, w, Z, 16);
+    for (std::size_t j = 0; j < count; ++ j)
+        BOOST_UBLAS_TEST_CHECK (std::abs (w (j) - all (size - 1 - j)) < TOL);
+    check_pairs (A, w, Z, test_fails__);
+
+    // a cluster of equal leading eigenvalues still gets orthogonal vectors
+    ublas::vector<double> lambda (size);
+    for (std::size_t i = 0; i < size; ++ i)
+        lambda (i) = i < 5 ? 3.0 : random_value ();
+    const ublas::matrix<double> B (with_eigenvalues (lambda));
+    ublas::symmetric_eigen_largest (B, w, Z);
+    for (std::size_t j = 0; j < 5; ++ j)
+        BOOST_UBLAS_TEST_CHECK (std::abs (w (j) - 3.0) < TOL);
+    check_pairs (B, w, Z, test_fails__);
+}
+
+// exactly zero eigenvalues come back as zero
+BOOST_UBLAS_TEST_DEF ( test_zero )
+{
+    const std::size_t size = 20, count = 3;
+    const ublas::zero_matrix<double> A (size, size);
+    ublas::vector<double> w (count);
+    ublas::matrix<double> Z (size, count);
+    ublas::symmetric_eigen_largest (A, w, Z);
+    for (std::size_t j = 0; j < count; ++ j)
+        BOOST_UBLAS_TEST_CHECK_EQ (w (j), 0.0);
+    check_pairs (A, w, Z, test_fails__);
+
+    ublas::matrix<double> D (A);
+    D (0, 0) = -1.0;
+    D (1, 1) = 1.0;
+    ublas::symmetric_eigen_largest (D, w, Z);
+    BOOST_UBLAS_TEST_CHECK (std::abs (w (0) - 1.0) < TOL);
+    BOOST_UBLAS_TEST_CHECK (std::abs (w (1)) < TOL && std::abs (w (2)) < TOL);
+    check_pairs (D, w, Z, test_fails__);
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_tridiagonal );
+    BOOST_UBLAS_TEST_DO( test_dense );
+    BOOST_UBLAS_TEST_DO( test_multiple );
+    BOOST_UBLAS_TEST_DO( test_largest );
+    BOOST_UBLAS_TEST_DO( test_zero );
+
+    BOOST_UBLAS_TEST_END();
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/triangular_sparse.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+static const std::size_t nx(6);          ///< grid points per direction
+static const std::size_t n(nx * nx);     ///< size of the test matrix
+
+// 5-point stencil on a nx x nx grid, with a non symmetric twist so that
+// lower and upper triangles differ
+template<class mat>
+void fill_matrix (mat &A) {
+    for (std::size_t i = 0; i < n; ++ i) {
+        if (i >= nx)
+            A (i, i - nx) = -1.0;
+        if (i % nx != 0)
+            A (i, i - 1) = -0.5;
+        A (i, i) = 4.0 + 0.1 * i;
+        if (i % nx != nx - 1)
+            A (i, i + 1) = -1.5;
+        if (i + nx < n)
+            A (i, i + nx) = -2.0;
+    }
+}
+
+template<class mat, class TRI>
+void check_vector_solve (const mat &A, std::size_t &test_fails__) {
+    ublas::matrix<double> D (A);
+    ublas::vector<double> b (n);
+    for (std::size_t i = 0; i < n; ++ i)
+        b (i) = 1.0 + 0.25 * i;
+
+    ublas::level_schedule<mat, TRI> s (A);
+    ublas::vector<double> x (b);
+    ublas::inplace_solve (A, x, s);
+    ublas::vector<double> y (b);
+    ublas::inplace_solve (D, y, TRI ());
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (x, y, n, TOL);
+
+    // the schedule is reused for a second right hand side
+    ublas::vector<double> x2 (2.0 * b);
+    ublas::inplace_solve (A, x2, s);
+    BOOST_UBLAS_TEST_CHECK_VECTOR_CLOSE (x2, 2.0 * y, n, TOL);
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_vector_solve )
+{
+    mat A (n, n);
+    fill_matrix (A);
+    check_vector_solve<mat, ublas::lower_tag> (A, test_fails__);
+    check_vector_solve<mat, ublas::unit_lower_tag> (A, test_fails__);
+    check_vector_solve<mat, ublas::upper_tag> (A, test_fails__);
+    check_vector_solve<mat, ublas::unit_upper_tag> (A, test_fails__);
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_levels )
+{
+    mat A (n, n);
+    fill_matrix (A);
+
+    // the grid is swept along anti-diagonals: 2 * nx - 1 levels instead of n
+    ublas::level_schedule<mat, ublas::lower_tag> sl (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (sl.levels (), 2 * nx - 1);
+    BOOST_UBLAS_TEST_CHECK_EQ (sl.level_ptr () [sl.levels ()], n);
+    ublas::level_schedule<mat, ublas::upper_tag> su (A);
+    BOOST_UBLAS_TEST_CHECK_EQ (su.levels (), 2 * nx - 1);
+
+    // a diagonal matrix has a single level
+    mat I (n, n);
+    for (std::size_t i = 0; i < n; ++ i)
+        I (i, i) = 2.0;
+    ublas::level_schedule<mat, ublas::lower_tag> sd (I);
+    BOOST_UBLAS_TEST_CHECK_EQ (sd.levels (), std::size_t (1));
+}
+
+template<class mat>
+BOOST_UBLAS_TEST_DEF ( test_matrix_solve )
+{
+    mat A (n, n);
+    fill_matrix (A);
+    ublas::matrix<double> D (A);
+    ublas::matrix<double> B (n, 3);
+    for (std::size_t i = 0; i < n; ++ i)
+        for (std::size_t j = 0; j < 3; ++ j)
+            B (i, j) = 1.0 + i - 2.0 * j;
+
+    ublas::level_schedule<mat, ublas::lower_tag> sl (A);
+    ublas::matrix<double> X (B);
+    ublas::inplace_solve (A, X, sl);
+    ublas::matrix<double> Y (B);
+    ublas::inplace_solve (D, Y, ublas::lower_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (X, Y, n, 3, TOL);
+
+    ublas::level_schedule<mat, ublas::unit_upper_tag> su (A);
+    X = B;
+    ublas::inplace_solve (A, X, su);
+    Y = B;
+    ublas::inplace_solve (D, Y, ublas::unit_upper_tag ());
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (X, Y, n, 3, TOL);
+}
+
+int main () {
+
+    // typedefs are needed as macros do not work with "," in template arguments
+    typedef ublas::compressed_matrix<double, ublas::row_major>     commat_doub_rowmaj;
+    typedef ublas::compressed_matrix<double, ublas::row_major, 1>  commat_doub_rowmaj_1;
+
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_vector_solve<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_vector_solve<commat_doub_rowmaj_1> );
+    BOOST_UBLAS_TEST_DO( test_levels<commat_doub_rowmaj> );
+    BOOST_UBLAS_TEST_DO( test_matrix_solve<commat_doub_rowmaj> );
+
+    BOOST_UBLAS_TEST_END();
+}
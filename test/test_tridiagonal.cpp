@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 The Boost uBLAS developers
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/numeric/ublas/tridiagonal.hpp>
+#include <boost/numeric/ublas/banded.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/io.hpp>
+
+#include "utils.hpp"
+
+#include <cstdlib>
+
+namespace ublas = boost::numeric::ublas;
+
+static const double TOL(1.0e-10);
+
+double random_value () {
+    return double (std::rand ()) / RAND_MAX - 0.5;
+}
+
+// Diagonally dominant system of order size
+struct tridiagonal_system {
+    tridiagonal_system (std::size_t size): dl (size - 1), d (size), du (size - 1) {
+        for (std::size_t i = 0; i + 1 < size; ++ i) {
+            dl (i) = random_value ();
+            du (i) = random_value ();
+        }
+        for (std::size_t i = 0; i < size; ++ i)
+            d (i) = 2.0 + random_value ();
+    }
+    ublas::banded_matrix<double> matrix () const {
+        const std::size_t size = d.size ();
+        ublas::banded_matrix<double> A (size, size, 1, 1);
+        for (std::size_t i = 0; i < size; ++ i) {
+            A (i, i) = d (i);
+            if (i + 1 < size) {
+                A (i + 1, i) = dl (i);
+                A (i, i + 1) = du (i);
+            }
+        }
+        return A;
+    }
+    ublas::vector<double> dl, d, du;
+};
+
+ublas::vector<double> solution (std::size_t size, std::size_t shift) {
+    ublas::vector<double> x (size);
+    for (std::size_t i = 0; i < size; ++ i)
+        x (i) = 1.0 + double ((i + shift) % 17) / 17;
+    return x;
+}
+
+BOOST_UBLAS_TEST_DEF ( test_thomas )
+{
+    const std::size_t size = 1000;
+    const tridiagonal_system s (size);
+    const ublas::banded_matrix<double> A (s.matrix ());
+    const ublas::vector<double> x (solution (size, 0));
+
+    ublas::vector<double> b (ublas::prod (A, x));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (s.dl, s.d, s.du, b), std::size_t (0));
+    for (std::size_t i = 0; i < size; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+
+    b = ublas::prod (A, x);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (A, b), std::size_t (0));
+    for (std::size_t i = 0; i < size; ++ i)
+        BOOST_UBLAS_TEST_CHECK_CLOSE (b (i), x (i), TOL);
+
+    // several right hand sides, row and column major
+    ublas::matrix<double> X (size, 70);
+    for (std::size_t j = 0; j < 70; ++ j)
+        ublas::column (X, j) = solution (size, j);
+    ublas::matrix<double> B (ublas::prod (A, X));
+    ublas::matrix<double, ublas::column_major> C (B);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (A, B), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (B, X, size, 70, TOL);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (s.dl, s.d, s.du, C), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (C, X, size, 70, TOL);
+
+    // a zero pivot is reported and leaves the right hand side alone
+    ublas::vector<double> d (s.d);
+    d (0) = 0.0;
+    b = x;
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (s.dl, d, s.du, b), std::size_t (1));
+    BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (b - x) == 0.0);
+
+    // orders 1 and 2
+    ublas::vector<double> e (1, 4.0), f (0);
+    ublas::vector<double> r (1, 2.0);
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (f, e, f, r), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_CLOSE (r (0), 0.5, TOL);
+    const tridiagonal_system t (2);
+    const ublas::vector<double> y (solution (2, 3));
+    ublas::vector<double> c (ublas::prod (t.matrix (), y));
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::tridiagonal_solve (t.dl, t.d, t.du, c), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_CLOSE (c (0), y (0), TOL);
+    BOOST_UBLAS_TEST_CHECK_CLOSE (c (1), y (1), TOL);
+}
+
+BOOST_UBLAS_TEST_DEF ( test_cyclic_reduction )
+{
+    const std::size_t sizes [] = {1, 2, 3, 7, 8, 9, 1000, 100003};
+    for (std::size_t n = 0; n < sizeof (sizes) / sizeof (sizes [0]); ++ n) {
+        const std::size_t size = sizes [n];
+        const tridiagonal_system s (size);
+        const ublas::vector<double> x (solution (size, n));
+        ublas::vector<double> b (size);
+        ublas::axpy_prod (s.matrix (), x, b);
+        BOOST_UBLAS_TEST_CHECK_EQ (ublas::cyclic_reduction_solve (s.dl, s.d, s.du, b), std::size_t (0));
+        BOOST_UBLAS_TEST_CHECK (ublas::norm_inf (b - x) < TOL);
+    }
+
+    const tridiagonal_system s (10);
+    ublas::vector<double> d (s.d);
+    d (4) = 0.0;
+    ublas::vector<double> b (10, 1.0);
+    ublas::vector<double> dl (s.dl), du (s.du);
+    dl (3) = du (4) = 0.0;
+    BOOST_UBLAS_TEST_CHECK (ublas::cyclic_reduction_solve (dl, d, du, b) != std::size_t (0));
+}
+
+template<class L>
+BOOST_UBLAS_TEST_DEF ( test_batched )
+{
+    const std::size_t size = 50, systems = 300;
+    ublas::matrix<double, L> DL (size - 1, systems), D (size, systems), DU (size - 1, systems);
+    ublas::matrix<double, L> X (size, systems), B (size, systems);
+    for (std::size_t k = 0; k < systems; ++ k) {
+        const tridiagonal_system s (size);
+        ublas::column (DL, k) = s.dl;
+        ublas::column (D, k) = s.d;
+        ublas::column (DU, k) = s.du;
+        ublas::column (X, k) = solution (size, k);
+        ublas::column (B, k) = ublas::prod (s.matrix (), ublas::column (X, k));
+    }
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::batched_tridiagonal_solve (DL, D, DU, B), std::size_t (0));
+    BOOST_UBLAS_TEST_CHECK_MATRIX_CLOSE (B, X, size, systems, TOL);
+
+    // the first singular system is reported
+    D (0, 250) = 0.0;
+    D (0, 131) = 0.0;
+    BOOST_UBLAS_TEST_CHECK_EQ (ublas::batched_tridiagonal_solve (DL, D, DU, B), std::size_t (132));
+}
+
+int main () {
+    BOOST_UBLAS_TEST_BEGIN();
+
+    BOOST_UBLAS_TEST_DO( test_thomas );
+    BOOST_UBLAS_TEST_DO( test_cyclic_reduction );
+    BOOST_UBLAS_TEST_DO( test_batched<ublas::row_major> );
+    BOOST_UBLAS_TEST_DO( test_batched<ublas::column_major> );
+
+    BOOST_UBLAS_TEST_END();
+}